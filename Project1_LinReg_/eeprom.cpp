@@ -0,0 +1,101 @@
+#include <eeprom.hpp>
+
+namespace yrgo {
+namespace driver {
+namespace eeprom {
+
+namespace {
+
+/********************************************************************************
+ * @brief Byte queued for an asynchronous write.
+ ********************************************************************************/
+struct Entry {
+    uint16_t address;        /* Destination address. */
+    uint8_t data;            /* Byte to write. */
+    void (*callback)(void);  /* Routine called once written, set for the last byte of a write. */
+};
+
+Entry queue[kQueueSize]{};
+volatile uint8_t head{};
+volatile uint8_t count{};
+void (*volatile finished_callback)(void){nullptr};
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Called with interrupts disabled when no write is in progress, i.e.
+ *           from the EEPROM ready interrupt or from Flush.
+ *        2. The callback of a write whose last byte has finished is called.
+ *        3. Queued bytes already holding the specified value are skipped until
+ *           a byte differs, after which its write is started and the routine
+ *           returns. The next interrupt occurs once the write has finished.
+ *        4. The interrupt is disabled once the queue is empty and no callback
+ *           remains, since it's triggered continuously while enabled.
+ ********************************************************************************/
+void ServiceQueue(void) {
+    if (finished_callback) {
+        const auto callback{finished_callback};
+        finished_callback = nullptr;
+        callback();
+    }
+    while (count > 0) {
+        const auto entry{queue[head]};
+        head = (head + 1) % kQueueSize;
+        count = count - 1;
+        EEAR = entry.address;
+        utils::Set(EECR, EERE);
+        if (EEDR != entry.data) {
+            EEDR = entry.data;
+            utils::Set(EECR, EEMPE);
+            utils::Set(EECR, EEPE);
+            finished_callback = entry.callback;
+            return;
+        }
+        if (entry.callback) entry.callback();
+    }
+    utils::Clear(EECR, EERIE);
+}
+
+} /* namespace */
+
+bool WriteAsync(const uint16_t address, const uint8_t* data, const size_t size,
+                void (*callback_routine)(void)) {
+    if (!detail::RangeValid(address, size)) return false;
+    const auto status{utils::SaveAndDisableInterrupts()};
+    if (size > static_cast<size_t>(kQueueSize - count)) {
+        utils::RestoreInterrupts(status);
+        return false;
+    }
+    for (size_t i{}; i < size; ++i) {
+        auto& entry{queue[(head + count) % kQueueSize]};
+        entry.address = static_cast<uint16_t>(address + i);
+        entry.data = data[i];
+        entry.callback = i + 1 == size ? callback_routine : nullptr;
+        count = count + 1;
+    }
+    if (size > 0) utils::Set(EECR, EERIE);
+    utils::RestoreInterrupts(status);
+    return true;
+}
+
+bool Busy(void) {
+    const auto status{utils::SaveAndDisableInterrupts()};
+    const bool busy{count > 0 || finished_callback || utils::Read(EECR, EEPE)};
+    utils::RestoreInterrupts(status);
+    return busy;
+}
+
+void Flush(void) {
+    while (Busy()) {
+        const auto status{utils::SaveAndDisableInterrupts()};
+        if (!utils::Read(EECR, EEPE)) ServiceQueue();
+        utils::RestoreInterrupts(status);
+    }
+}
+
+ISR (EE_READY_vect) {
+    ServiceQueue();
+}
+
+} /* namespace eeprom */
+} /* namespace driver */
+} /* namespace yrgo */
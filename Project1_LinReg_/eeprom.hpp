@@ -25,6 +25,57 @@ static constexpr uint16_t kAddressWidth{1024};
 static constexpr uint16_t kAddressMin{0};
 static constexpr uint16_t kAddressMax{kAddressWidth - 1};
 
+/********************************************************************************
+ * @brief Number of bytes the asynchronous write queue can hold. A full queue
+ *        is written within 32 * 3.3 ms = 106 ms.
+ ********************************************************************************/
+static constexpr uint8_t kQueueSize{32};
+
+/********************************************************************************
+ * @brief Queues specified bytes to be written to consecutive addresses in EEPROM
+ *        and returns immediately. The bytes are written one by one from the
+ *        EEPROM ready interrupt (EE_READY_vect), so the CPU isn't blocked during
+ *        the 3.3 ms write time of each byte. Bytes already holding the specified
+ *        value are skipped. Global interrupts must be enabled for the queue to
+ *        be drained, see Flush otherwise.
+ *
+ *        The bytes are copied, so the data can be modified after the call.
+ *        Reads return the previous value of an address until its queued byte
+ *        has been written, see Busy.
+ *
+ * @param address
+ *        The first destination address.
+ * @param data
+ *        Pointer to the bytes to write.
+ * @param size
+ *        The number of bytes to write.
+ * @param callback_routine
+ *        Function pointer to routine called once the last byte has been written
+ *        (default = nullptr). The routine is called from the interrupt service
+ *        routine and shall therefore be short.
+ * @return
+ *        True if the bytes were queued, false if the bytes don't fit in EEPROM
+ *        or in the free space of the queue (then nothing is queued).
+ ********************************************************************************/
+bool WriteAsync(const uint16_t address, const uint8_t* data, const size_t size,
+                void (*callback_routine)(void) = nullptr);
+
+/********************************************************************************
+ * @brief Indicates if asynchronous writes are pending or in progress.
+ *
+ * @return
+ *        True if the EEPROM is busy, else false.
+ ********************************************************************************/
+bool Busy(void);
+
+/********************************************************************************
+ * @brief Blocks until all queued bytes have been written, for instance before
+ *        shutdown or before entering a sleep mode. The queue is also drained
+ *        if global interrupts are disabled. Since the queue holds at most
+ *        kQueueSize bytes, Flush returns well within the watchdog timeout.
+ ********************************************************************************/
+void Flush(void);
+
 namespace {
 namespace detail {
 
@@ -43,7 +94,40 @@ bool constexpr AddressValid(const uint16_t address) {
 }
 
 /********************************************************************************
- * @brief Writes a single byte of data to specified address in EEPROM.
+ * @brief Indicates if specified number of bytes starting at specified address
+ *        fits within the EEPROM memory.
+ *
+ * @param address
+ *        The first address.
+ * @param size
+ *        The number of bytes.
+ * @return
+ *        True if the address range is valid, else false.
+ ********************************************************************************/
+bool constexpr RangeValid(const uint16_t address, const size_t size) {
+    return size <= kAddressWidth && address <= kAddressWidth - size;
+}
+
+/********************************************************************************
+ * @brief Disables interrupts once no EEPROM write is in progress, so that the
+ *        EEPROM registers can be accessed without the asynchronous writer
+ *        starting a write in between.
+ *
+ * @return
+ *        The status register to restore via utils::RestoreInterrupts.
+ ********************************************************************************/
+uint8_t LockWhenReady(void) {
+    while (true) {
+        const auto status{utils::SaveAndDisableInterrupts()};
+        if (!utils::Read(EECR, EEPE)) return status;
+        utils::RestoreInterrupts(status);
+    }
+}
+
+/********************************************************************************
+ * @brief Writes a single byte of data to specified address in EEPROM. The
+ *        interrupt state is restored afterwards, so interrupts aren't enabled
+ *        if the function is called with interrupts disabled.
  *
  * @param address
  *        The destination address.
@@ -51,13 +135,12 @@ bool constexpr AddressValid(const uint16_t address) {
  *        The data to write to the destination address.
  ********************************************************************************/
 void WriteByte(const uint16_t address, const uint8_t data) {
-    while (utils::Read(EECR, EEPE));
+    const auto status{LockWhenReady()};
 	EEAR = address;
 	EEDR = data;
-	utils::GlobalInterruptDisable();
 	utils::Set(EECR, EEMPE);
 	utils::Set(EECR, EEPE);
-    utils::GlobalInterruptEnable();
+    utils::RestoreInterrupts(status);
 }
 
 /********************************************************************************
@@ -69,17 +152,21 @@ void WriteByte(const uint16_t address, const uint8_t data) {
  *        The data stored at specified address.
  ********************************************************************************/
 uint8_t ReadByte(const uint16_t address) {
-    while (utils::Read(EECR, EEPE));
+    const auto status{LockWhenReady()};
 	EEAR = address;
 	utils::Set(EECR, EERE);
-	return EEDR;
+	const uint8_t data{EEDR};
+    utils::RestoreInterrupts(status);
+	return data;
 }
 } /* namespace detail */
 
 /********************************************************************************
  * @brief Writes data to specified address in EEPROM. If more than one byte is
  *        to be written, the other bytes are written to the consecutive addresses 
- *        until all bytes are stored.
+ *        until all bytes are stored. The CPU is blocked for 3.3 ms per byte, see
+ *        WriteAsync to write without blocking. Queued asynchronous writes are
+ *        completed first, so the writes are performed in call order.
  *
  * @param address
  *        The destination address.
@@ -92,6 +179,7 @@ template <typename T = uint8_t>
 bool Write(const uint16_t address, const T& data) {
     static_assert(type_traits::is_unsigned<T>::value, "EEPROM write only permitted for unsigned data types!");
     if (!detail::AddressValid<T>(address)) return false;
+    Flush();
 	for (size_t i{}; i < sizeof(T); ++i) {
 	    detail::WriteByte(address + i, static_cast<uint8_t>(data >> (8 * i)));
 	}
@@ -120,6 +208,67 @@ bool Read(const uint16_t address, T& data) {
 	return true;
 }
 
+/********************************************************************************
+ * @brief Writes specified bytes to consecutive addresses in EEPROM, for instance
+ *        a serialized model or any data type not permitted by Write, such as
+ *        floating-point and fixed-point numbers. Bytes already holding the
+ *        specified value are skipped, which saves the 3.3 ms write time and
+ *        the wear of the EEPROM cell. The CPU is blocked while writing, see
+ *        WriteAsync to write without blocking. Queued asynchronous writes are
+ *        completed first.
+ *
+ * @param address
+ *        The first destination address.
+ * @param data
+ *        Pointer to the bytes to write.
+ * @param size
+ *        The number of bytes to write.
+ * @return
+ *        True if the write succeeded, false if the bytes don't fit in EEPROM.
+ ********************************************************************************/
+bool WriteBytes(const uint16_t address, const uint8_t* data, const size_t size) {
+    if (!detail::RangeValid(address, size)) return false;
+    Flush();
+    for (size_t i{}; i < size; ++i) {
+        if (detail::ReadByte(address + i) != data[i]) {
+            detail::WriteByte(address + i, data[i]);
+        }
+    }
+    return true;
+}
+
+/********************************************************************************
+ * @brief Reads bytes from consecutive addresses in EEPROM.
+ *
+ * @param address
+ *        The first address to read from.
+ * @param data
+ *        Pointer to storage for the bytes read, which must hold size bytes.
+ * @param size
+ *        The number of bytes to read.
+ * @return
+ *        True if the read succeeded, false if the bytes don't fit in EEPROM.
+ ********************************************************************************/
+bool ReadBytes(const uint16_t address, uint8_t* data, const size_t size) {
+    if (!detail::RangeValid(address, size)) return false;
+    for (size_t i{}; i < size; ++i) {
+        data[i] = detail::ReadByte(address + i);
+    }
+    return true;
+}
+
+/********************************************************************************
+ * @brief Memory policy for storing logs in EEPROM via LogStore, for instance
+ *        yrgo::LogStore<kRecordSize, eeprom::Memory> store{0, kAddressWidth}.
+ *        Bytes are written via the asynchronous write queue, so the log shares
+ *        the EEPROM with other asynchronous writers.
+ ********************************************************************************/
+struct Memory {
+    static bool Ready(void) { return !Busy(); }
+    static uint8_t ReadByte(const uint16_t address) { return detail::ReadByte(address); }
+    static void WriteByte(const uint16_t address, const uint8_t data) { WriteAsync(address, &data, 1); }
+};
+
 } /* namespace */
 } /* namespace eeprom */
 } /* namespace driver */
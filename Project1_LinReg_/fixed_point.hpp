@@ -0,0 +1,273 @@
+/********************************************************************************
+ * @brief Implementation of saturating fixed-point numbers, which enables
+ *        arithmetic with integer instructions only on devices lacking a
+ *        floating-point unit.
+ ********************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+namespace yrgo {
+namespace fixed {
+
+/********************************************************************************
+ * @brief Class for implementation of signed 32-bit fixed-point numbers with a
+ *        configurable number of fractional bits, for instance Q16.16 or Q8.24.
+ *        All operations saturate at the minimum and maximum values instead
+ *        of overflowing.
+ ********************************************************************************/
+template <uint8_t frac_bits>
+class Fixed {
+    static_assert(frac_bits > 0 && frac_bits < 31, "Invalid number of fractional bits!");
+  public:
+    static constexpr uint8_t kFracBits{frac_bits};    /* Number of fractional bits. */
+    static constexpr int32_t kRawMax{INT32_MAX};      /* Maximum raw value. */
+    static constexpr int32_t kRawMin{INT32_MIN};      /* Minimum raw value. */
+    static constexpr int32_t kRawOne{1L << frac_bits}; /* Raw value of 1.0. */
+
+    /********************************************************************************
+     * @brief Default constructor, creates fixed-point number set to 0.
+     ********************************************************************************/
+    constexpr Fixed(void) = default;
+
+    /********************************************************************************
+     * @brief Creates fixed-point number from specified floating-point number,
+     *        rounded to the nearest representable value. Values out of range
+     *        (including infinity) saturate, while NaN is converted to 0.
+     *
+     * @param value
+     *        The value to convert.
+     ********************************************************************************/
+    constexpr explicit Fixed(const double value) : raw_{Convert(value)} {}
+
+    /********************************************************************************
+     * @brief Creates fixed-point number from specified raw value.
+     *
+     * @param raw
+     *        The raw value, i.e. the value multiplied by 2^frac_bits.
+     * @return
+     *        The corresponding fixed-point number.
+     ********************************************************************************/
+    static constexpr Fixed FromRaw(const int32_t raw) {
+        Fixed number{};
+        number.raw_ = raw;
+        return number;
+    }
+
+    /********************************************************************************
+     * @brief Returns the raw value of the fixed-point number.
+     *
+     * @return
+     *        The raw value, i.e. the value multiplied by 2^frac_bits.
+     ********************************************************************************/
+    constexpr int32_t Raw(void) const { return raw_; }
+
+    /********************************************************************************
+     * @brief Converts the fixed-point number to floating-point.
+     *
+     * @return
+     *        The corresponding floating-point number.
+     ********************************************************************************/
+    constexpr explicit operator double(void) const {
+        return static_cast<double>(raw_) / kRawOne;
+    }
+
+    /********************************************************************************
+     * @brief Rounds the fixed-point number to the nearest integer.
+     *
+     * @return
+     *        The corresponding rounded integer.
+     ********************************************************************************/
+    constexpr int32_t Round(void) const {
+        return static_cast<int32_t>((static_cast<int64_t>(raw_) + kRawOne / 2) >> frac_bits);
+    }
+
+    /********************************************************************************
+     * @brief Saturates specified wide raw value to the 32-bit range.
+     *
+     * @param raw
+     *        The raw value to saturate.
+     * @return
+     *        The saturated raw value.
+     ********************************************************************************/
+    static constexpr int32_t Saturate(const int64_t raw) {
+        return raw > kRawMax ? kRawMax : raw < kRawMin ? kRawMin : static_cast<int32_t>(raw);
+    }
+
+    /********************************************************************************
+     * @brief Multiplies two raw values with rounding to the nearest value. The
+     *        product is returned with double width so it can be accumulated
+     *        without intermediate saturation.
+     *
+     * @param a
+     *        The first raw factor.
+     * @param b
+     *        The second raw factor.
+     * @return
+     *        The rounded raw product before saturation.
+     ********************************************************************************/
+    static constexpr int64_t Multiply(const int32_t a, const int32_t b) {
+        return (static_cast<int64_t>(a) * b + (1LL << (frac_bits - 1))) >> frac_bits;
+    }
+
+    /********************************************************************************
+     * @brief Saturating arithmetic operators. The raw values are added and
+     *        multiplied with double width before saturating to 32 bits.
+     ********************************************************************************/
+    constexpr Fixed operator-(void) const { return FromRaw(Saturate(-static_cast<int64_t>(raw_))); }
+    constexpr Fixed& operator+=(const Fixed& other) { return *this = *this + other; }
+    constexpr Fixed& operator-=(const Fixed& other) { return *this = *this - other; }
+    constexpr Fixed& operator*=(const Fixed& other) { return *this = *this * other; }
+    constexpr Fixed& operator/=(const Fixed& other) { return *this = *this / other; }
+
+    friend constexpr Fixed operator+(const Fixed& a, const Fixed& b) {
+        return FromRaw(Saturate(static_cast<int64_t>(a.raw_) + b.raw_));
+    }
+
+    friend constexpr Fixed operator-(const Fixed& a, const Fixed& b) {
+        return FromRaw(Saturate(static_cast<int64_t>(a.raw_) - b.raw_));
+    }
+
+    friend constexpr Fixed operator*(const Fixed& a, const Fixed& b) {
+        return FromRaw(Saturate(Multiply(a.raw_, b.raw_)));
+    }
+
+    /********************************************************************************
+     * @brief Divides two fixed-point numbers. Division by zero saturates towards
+     *        the sign of the dividend.
+     ********************************************************************************/
+    friend constexpr Fixed operator/(const Fixed& a, const Fixed& b) {
+        if (b.raw_ == 0) return FromRaw(a.raw_ < 0 ? kRawMin : kRawMax);
+        return FromRaw(Saturate(static_cast<int64_t>(a.raw_) * kRawOne / b.raw_));
+    }
+
+    /********************************************************************************
+     * @brief Comparison operators, which compare the raw values.
+     ********************************************************************************/
+    friend constexpr bool operator==(const Fixed& a, const Fixed& b) { return a.raw_ == b.raw_; }
+    friend constexpr bool operator!=(const Fixed& a, const Fixed& b) { return a.raw_ != b.raw_; }
+    friend constexpr bool operator<(const Fixed& a, const Fixed& b) { return a.raw_ < b.raw_; }
+    friend constexpr bool operator>(const Fixed& a, const Fixed& b) { return a.raw_ > b.raw_; }
+    friend constexpr bool operator<=(const Fixed& a, const Fixed& b) { return a.raw_ <= b.raw_; }
+    friend constexpr bool operator>=(const Fixed& a, const Fixed& b) { return a.raw_ >= b.raw_; }
+
+  private:
+
+    /********************************************************************************
+     * @brief Converts specified floating-point number to a saturated raw value.
+     *        The value is clamped as floating-point before the conversion, since
+     *        converting a value out of the integer range is undefined.
+     *
+     * @param value
+     *        The value to convert.
+     * @return
+     *        The rounded and saturated raw value.
+     ********************************************************************************/
+    static constexpr int32_t Convert(const double value) {
+        const double raw{value * kRawOne + (value < 0 ? -0.5 : 0.5)};
+        if (raw != raw) return 0;
+        if (raw >= kRawMax) return kRawMax;
+        if (raw <= kRawMin) return kRawMin;
+        return static_cast<int32_t>(raw);
+    }
+
+    int32_t raw_{}; /* Raw value, i.e. the value multiplied by 2^frac_bits. */
+};
+
+/********************************************************************************
+ * @brief Fixed-point number with 16 integer bits and 16 fractional bits, i.e.
+ *        the range [-32768, 32768) with a resolution of 1.5e-5.
+ ********************************************************************************/
+using Q16_16 = Fixed<16>;
+
+/********************************************************************************
+ * @brief Fixed-point number with 8 integer bits and 24 fractional bits, i.e.
+ *        the range [-128, 128) with a resolution of 6.0e-8.
+ ********************************************************************************/
+using Q8_24 = Fixed<24>;
+
+/********************************************************************************
+ * @brief Calculates a * b + c for arithmetic types.
+ *
+ * @param a
+ *        The first factor.
+ * @param b
+ *        The second factor.
+ * @param c
+ *        The term to add to the product.
+ * @return
+ *        The result a * b + c.
+ ********************************************************************************/
+template <typename T>
+constexpr T MulAdd(const T a, const T b, const T c) {
+    return a * b + c;
+}
+
+/********************************************************************************
+ * @brief Calculates a * b + c for fixed-point numbers. The product is added
+ *        with double width, so the result is only saturated (and rounded) once.
+ *
+ * @param a
+ *        The first factor.
+ * @param b
+ *        The second factor.
+ * @param c
+ *        The term to add to the product.
+ * @return
+ *        The saturated result a * b + c.
+ ********************************************************************************/
+template <uint8_t frac_bits>
+constexpr Fixed<frac_bits> MulAdd(const Fixed<frac_bits> a,
+                                  const Fixed<frac_bits> b,
+                                  const Fixed<frac_bits> c) {
+    using Number = Fixed<frac_bits>;
+    return Number::FromRaw(Number::Saturate(Number::Multiply(a.Raw(), b.Raw()) + c.Raw()));
+}
+
+/********************************************************************************
+ * @brief Provides the number of fractional bits of specified scalar type,
+ *        which is 0 for types other than fixed-point numbers.
+ ********************************************************************************/
+template <typename T>
+struct FracBits {
+    static constexpr uint8_t value{0};
+};
+
+/********************************************************************************
+ * @brief Provides the number of fractional bits of fixed-point numbers.
+ ********************************************************************************/
+template <uint8_t frac_bits>
+struct FracBits<Fixed<frac_bits>> {
+    static constexpr uint8_t value{frac_bits};
+};
+
+/********************************************************************************
+ * @brief Truncates specified arithmetic value towards zero.
+ *
+ * @param value
+ *        The value to truncate.
+ * @return
+ *        The truncated value as an integer.
+ ********************************************************************************/
+template <typename T>
+constexpr int32_t Truncate(const T value) {
+    return static_cast<int32_t>(value);
+}
+
+/********************************************************************************
+ * @brief Truncates specified fixed-point number towards zero by shifting out
+ *        the fractional bits, i.e. with integer instructions only.
+ *
+ * @param value
+ *        The value to truncate.
+ * @return
+ *        The truncated value as an integer.
+ ********************************************************************************/
+template <uint8_t frac_bits>
+constexpr int32_t Truncate(const Fixed<frac_bits> value) {
+    return value.Raw() < 0 ? -static_cast<int32_t>(-static_cast<int64_t>(value.Raw()) >> frac_bits)
+                           : value.Raw() >> frac_bits;
+}
+
+} /* namespace fixed */
+} /* namespace yrgo */
@@ -4,16 +4,71 @@
 #pragma once
 
 #include <vector.hpp>
+#include <online_lin_reg.hpp>
+#include <fixed_point.hpp>
+#include <simd.hpp>
+#include <random.hpp>
+#include <optimizer.hpp>
+#include <schedule.hpp>
+#include <crc.hpp>
+#include <training.hpp>
+#include <math.h>
 #include <stdlib.h>
-#include <time.h>
+#include <string.h>
 
 namespace yrgo {
 
 /********************************************************************************
- * @brief Class for implementing linear regression models.
+ * @brief Enumeration of training modes.
+ * 
+ * @param kStochastic
+ *        The model is optimized after each training set, in random order.
+ * @param kBatch
+ *        The model is optimized once per epoch with the average gradient of 
+ *        all training sets.
+ * @param kMiniBatch
+ *        The model is optimized with the average gradient of each batch of
+ *        consecutive training sets.
  ********************************************************************************/
+enum class TrainMode { kStochastic, kBatch, kMiniBatch };
+
+/********************************************************************************
+ * @brief Enumeration of training orders in stochastic mode.
+ * 
+ * @param kShuffled
+ *        The training sets are shuffled before each epoch. Every order is 
+ *        equally likely, but an index vector of the same size as the training
+ *        data is stored.
+ * @param kAffine
+ *        The training order is generated on the fly as a random affine 
+ *        permutation (a * i + b) mod n for each epoch. No index vector is 
+ *        stored, which saves sizeof(size_t) bytes of RAM per training set.
+ ********************************************************************************/
+enum class TrainOrder { kShuffled, kAffine };
+
+/********************************************************************************
+ * @brief Class for implementing linear regression models. 
+ * 
+ * @tparam T
+ *         The scalar type used for training and prediction (default = double).
+ *         Fixed-point types such as fixed::Q16_16 can be used on devices without
+ *         a floating-point unit, so that training and prediction are performed
+ *         with integer instructions only.
+ * @tparam Optimizer
+ *         The optimizer used to adjust the parameters during training (default 
+ *         = plain stochastic gradient descent). See optimizer.hpp for the 
+ *         available optimizers.
+ * @tparam Buffer
+ *         The container storing the training data (default = container::Vector).
+ *         Any container with the API of container::Vector can be used, e.g. a
+ *         container::SmallVector alias, which keeps small training sets off 
+ *         the heap, see small_vector.hpp.
+ ********************************************************************************/
+template <typename T = double, template <typename> class Optimizer = optimizer::Sgd,
+          template <typename> class Buffer = container::Vector>
 class LinReg {
   public:
+    static constexpr size_t kSerializedSize{5 + 2 * sizeof(T) + 2}; /* Bytes written by Save. */
 
     /********************************************************************************
      * @brief Default constructor, creates empty regression model.
@@ -27,11 +82,28 @@ class LinReg {
      *        Reference to container::Vector containing input data (x).
      * @param train_out
      *        Reference to container::Vector containing reference data (y_ref).
+     * @param standardize
+     *        Indicates if the training data shall be standardized (default = false),
+     *        see LoadTrainingData.
      ********************************************************************************/
-    LinReg(const container::Vector<double>& train_in, const container::Vector<double>& train_out) {
-        LoadTrainingData(train_in, train_out);
+    LinReg(const container::Vector<T>& train_in, const container::Vector<T>& train_out,
+           const bool standardize = false) {
+        LoadTrainingData(train_in, train_out, standardize);
     }
 
+    /********************************************************************************
+     * @brief Creates new regression model with specified parameters, for instance
+     *        parameters calculated at compile time via TrainAtCompileTime.
+     * 
+     * @param weight
+     *        The weight (k-value) of the model.
+     * @param bias
+     *        The bias (m-value) of the model.
+     ********************************************************************************/
+    LinReg(const T weight, const T bias) 
+        : weight_{weight}
+        , bias_{bias} {}
+
     /********************************************************************************
      * @brief Makes a prediction with the specified input value. 
      *        The prediction is calculated as 
@@ -45,18 +117,82 @@ class LinReg {
      * @return
      *        The predicted value (y_pred).
      ********************************************************************************/
-    double Predict(const double input) const { return weight_ * input + bias_; }
+    T Predict(const T input) const { return fixed::MulAdd(weight_, input, bias_); }
+
+    /********************************************************************************
+     * @brief Makes predictions with all specified input values. The predictions
+     *        are calculated with SIMD instructions when available.
+     * 
+     * @param input
+     *        Pointer to the input values (x) to predict with.
+     * @param output
+     *        Pointer to storage for the predicted values (y_pred), which must hold
+     *        at least size values. The input can be overwritten by the predictions.
+     * @param size
+     *        The number of predictions to make.
+     ********************************************************************************/
+    void PredictBatch(const T* input, T* output, const size_t size) const {
+        simd::MulAdd(input, output, size, weight_, bias_);
+    }
+
+    /********************************************************************************
+     * @brief Makes predictions with all input values stored in referenced 
+     *        container::Vector. The output container::Vector is resized to
+     *        the number of input values.
+     * 
+     * @param input
+     *        Reference to container::Vector containing the input values (x).
+     * @param output
+     *        Reference to container::Vector for storing the predicted values (y_pred).
+     * @return
+     *        True if the predictions were made, false if the output 
+     *        container::Vector couldn't be resized.
+     ********************************************************************************/
+    bool PredictBatch(const container::Vector<T>& input, container::Vector<T>& output) const {
+        if (!output.Resize(input.Size())) return false;
+        PredictBatch(input.Data(), output.Data(), input.Size());
+        return true;
+    }
 
     /********************************************************************************
-     * @brief Loads training data from referenced container::Vectors.
+     * @brief Loads training data from referenced containers, for instance
+     *        container::Vectors. The training data is copied into the buffers
+     *        of the model.
+     * 
+     *        If standardization is enabled, the input and reference values are
+     *        stored as x' = (x - mean(x)) / std(x) and y' = (y - mean(y)) / std(y).
+     *        The model is then trained on values of unit scale regardless of the
+     *        units of the data, so the learning rate doesn't need to be tuned to 
+     *        the data. The parameters are converted back after training, so
+     *        predictions are still made with the original units.
      * 
      * @param train_in
-     *        Reference to container::Vector containing input data (x).
+     *        Reference to container containing input data (x).
      * @param train_out
-     *        Reference to container::Vector containing reference data (y_ref).s
+     *        Reference to container containing reference data (y_ref).
+     * @param standardize
+     *        Indicates if the training data shall be standardized (default = false).
+     * @return
+     *        True if the training data was loaded, false if the buffers couldn't 
+     *        be resized (no training data is stored).
      ********************************************************************************/
-    void LoadTrainingData(const container::Vector<double>& train_in, 
-                          const container::Vector<double>& train_out);
+    template <typename Container>
+    bool LoadTrainingData(const Container& train_in, const Container& train_out,
+                          const bool standardize = false);
+
+    /********************************************************************************
+     * @brief Loads training data by taking over the content of specified buffers,
+     *        so the values are not copied. See the overload above for details.
+     * 
+     * @param train_in
+     *        Reference to buffer containing input data (x), which is emptied.
+     * @param train_out
+     *        Reference to buffer containing reference data (y_ref), which is emptied.
+     * @param standardize
+     *        Indicates if the training data shall be standardized (default = false).
+     ********************************************************************************/
+    void LoadTrainingData(Buffer<T>&& train_in, Buffer<T>&& train_out,
+                          const bool standardize = false);
 
     /********************************************************************************
      * @brief Trains regression model with specified parameters.
@@ -64,27 +200,257 @@ class LinReg {
      * @param num_epochs
      *        The number of epochs (turns) to train.
      * @param learning_rate
-     *        The learning rate, sets the change rate during errors (default = 0.01).
+     *        The base learning rate, sets the change rate during errors, which is
+     *        adjusted each epoch according to the schedule (default = 0.01). If 
+     *        set to 0, a stable learning rate is derived from the input values, 
+     *        see AutoLearningRate.
+     * @param mode
+     *        The training mode (default = stochastic).
+     * @param batch_size
+     *        The number of training sets per batch in mini-batch mode (default = 32).
+     * @param tolerance
+     *        The training is stopped early when the summed change of the weight and 
+     *        bias during an epoch doesn't exceed the tolerance (default = 0, i.e.
+     *        the training is only stopped early if the parameters stop changing).
+     *        The change is measured in standardized units if the training data
+     *        is standardized.
+     * @param patience
+     *        The number of consecutive epochs within the tolerance required to stop
+     *        the training early (default = 1).
+     * @return
+     *        The number of epochs actually trained.
+     ********************************************************************************/
+    size_t Train(const size_t num_epochs, const T learning_rate = T{0.01}, 
+                 const TrainMode mode = TrainMode::kStochastic, const size_t batch_size = 32,
+                 const T tolerance = T{}, const size_t patience = 1);
+
+    /********************************************************************************
+     * @brief Fits the regression model to the stored training data with the 
+     *        closed-form least-squares solution. Only one pass through the training
+     *        sets is required, compared to num_epochs passes when training.
+     * 
+     * @return
+     *        True if the model was fitted, false if the stored training sets don't
+     *        contain at least two different input values (the model is unchanged).
+     ********************************************************************************/
+    bool Fit(void);
+
+    /********************************************************************************
+     * @brief Seeds the random generator used to shuffle the training order in
+     *        stochastic mode. Models seeded with the same value and trained with
+     *        the same data and parameters yield identical results.
+     * 
+     * @param seed
+     *        The new seed of the random generator.
+     ********************************************************************************/
+    void Seed(const uint32_t seed) { rng_.Seed(seed); }
+
+    /********************************************************************************
+     * @brief Sets the order of the training sets in stochastic mode. The index
+     *        vector used for shuffling is released when the affine order is set.
+     * 
+     * @param order
+     *        The new training order.
+     ********************************************************************************/
+    void SetTrainOrder(const TrainOrder order) {
+        order_ = order;
+        if (order_ == TrainOrder::kAffine) train_order_.Clear();
+    }
+
+    /********************************************************************************
+     * @brief Returns the weight of the model.
+     * 
+     * @return
+     *        The weight (k-value) of the model.
+     ********************************************************************************/
+    T Weight(void) const { return weight_; }
+
+    /********************************************************************************
+     * @brief Returns the bias of the model.
+     * 
+     * @return
+     *        The bias (m-value) of the model.
+     ********************************************************************************/
+    T Bias(void) const { return bias_; }
+
+    /********************************************************************************
+     * @brief Indicates if the stored training data is standardized.
+     * 
+     * @return
+     *        True if the training data is standardized, else false.
+     ********************************************************************************/
+    bool Standardized(void) const { return standardized_; }
+
+    /********************************************************************************
+     * @brief Returns the parameters of the model in the units of the stored
+     *        training data, i.e. in standardized units if the training data is
+     *        standardized. This enables external trainers to operate directly
+     *        on TrainingInputs and TrainingOutputs.
+     * 
+     * @param weight
+     *        Reference to storage for the weight (k-value).
+     * @param bias
+     *        Reference to storage for the bias (m-value).
+     ********************************************************************************/
+    void StandardizedParameters(T& weight, T& bias) const;
+
+    /********************************************************************************
+     * @brief Sets the parameters of the model from parameters in the units of the
+     *        stored training data, which are converted back to the original units
+     *        if the training data is standardized. See SetParameters.
+     * 
+     * @param weight
+     *        The new weight (k-value) in the units of the stored training data.
+     * @param bias
+     *        The new bias (m-value) in the units of the stored training data.
+     ********************************************************************************/
+    void SetStandardizedParameters(const T weight, const T bias);
+
+    /********************************************************************************
+     * @brief Returns the stored input values, which are standardized if enabled.
+     * 
+     * @return
+     *        Reference to buffer containing input data (x).
+     ********************************************************************************/
+    const Buffer<T>& TrainingInputs(void) const { return train_in_; }
+
+    /********************************************************************************
+     * @brief Returns the stored reference values, which are standardized if enabled.
+     * 
+     * @return
+     *        Reference to buffer containing reference data (y_ref).
+     ********************************************************************************/
+    const Buffer<T>& TrainingOutputs(void) const { return train_out_; }
+
+    /********************************************************************************
+     * @brief Sets the parameters of the model, for instance parameters calculated
+     *        at compile time via TrainAtCompileTime. No training is required.
+     * 
+     * @param weight
+     *        The new weight (k-value) of the model.
+     * @param bias
+     *        The new bias (m-value) of the model.
+     ********************************************************************************/
+    void SetParameters(const T weight, const T bias) {
+        weight_ = weight;
+        bias_ = bias;
+        optimizer_.Reset();
+    }
+
+    /********************************************************************************
+     * @brief Serializes the parameters of the model into specified buffer, for
+     *        instance to store the model in EEPROM. The layout is:
+     * 
+     *        [0-1]  magic number "LR"
+     *        [2]    version of the layout
+     *        [3]    size of the scalar type in bytes
+     *        [4]    number of fractional bits of the scalar type (0 if not fixed point)
+     *        [5-]   weight followed by bias, stored as their raw bytes
+     *        [-2-1] CRC-16 of all preceding bytes, least significant byte first
+     * 
+     * @param data
+     *        Pointer to the buffer, which must hold at least kSerializedSize bytes.
+     * @param size
+     *        The size of the buffer in bytes.
+     * @return
+     *        True if the model was serialized, false if the buffer is too small.
+     ********************************************************************************/
+    bool Save(uint8_t* data, const size_t size) const;
+
+    /********************************************************************************
+     * @brief Loads parameters serialized via Save into the model. The buffer is
+     *        only accepted if the magic number, version, scalar type and checksum
+     *        match, for instance if the EEPROM was erased, written by another 
+     *        firmware or corrupted. The model is unchanged if the buffer is rejected.
+     * 
+     * @param data
+     *        Pointer to the buffer holding the serialized model.
+     * @param size
+     *        The size of the buffer in bytes.
+     * @return
+     *        True if the parameters were loaded, else false.
+     ********************************************************************************/
+    bool Load(const uint8_t* data, const size_t size);
+
+    /********************************************************************************
+     * @brief Sets the optimizer used during training, for instance to change the
+     *        hyperparameters of the optimizer.
+     * 
+     * @param optimizer
+     *        Reference to the new optimizer, which is copied.
      ********************************************************************************/
-    void Train(const size_t num_epochs, const double learning_rate = 0.01);
+    void SetOptimizer(const Optimizer<T>& optimizer) { optimizer_ = optimizer; }
+
+    /********************************************************************************
+     * @brief Sets the learning-rate schedule used during training.
+     * 
+     * @param schedule
+     *        Reference to the new schedule, e.g. Schedule::Exponential(0.99).
+     ********************************************************************************/
+    void SetSchedule(const Schedule& schedule) { schedule_ = schedule; }
+
+    /********************************************************************************
+     * @brief Returns the largest learning rate considered safe for plain gradient
+     *        descent on the stored training data, which is used if the training
+     *        is started with a learning rate of 0. The rate is derived from the
+     *        input values when the training data is loaded:
+     * 
+     *        stochastic and mini-batch mode: LR = 1 / (max(x^2) + 1)
+     *        batch mode:                     LR = 1 / (mean(x^2) + 1)
+     * 
+     *        Each update multiplies the parameter error by at most 1 - LR * (x^2 + 1),
+     *        so the training converges without oscillating.
+     * 
+     * @param mode
+     *        The training mode.
+     * @return
+     *        The derived learning rate.
+     ********************************************************************************/
+    T AutoLearningRate(const TrainMode mode) const {
+        return mode == TrainMode::kBatch ? batch_rate_ : stochastic_rate_;
+    }
 
   /********************************************************************************
    * @note The private segment is only visible internally (i.e. in this class).
    ********************************************************************************/
   private:
-    container::Vector<double> train_in_{};         /* Input values (x). */
-    container::Vector<double> train_out_{};        /* Reference values (y_ref). */
-    container::Vector<size_t> train_order_{}; /* Stores indexes for training sets. */
-    double weight_{};                        /* k-value. */
-    double bias_{};                          /* m-value. */
+    static constexpr uint8_t kMagic[]{'L', 'R'}; /* Identifies serialized models. */
+    static constexpr uint8_t kVersion{1};        /* Version of the serialized layout. */
+    static constexpr size_t kHeaderSize{5};      /* Size of magic, version and type. */
+
+    Buffer<T> train_in_{};                   /* Input values (x). */
+    Buffer<T> train_out_{};                  /* Reference values (y_ref). */
+    Buffer<size_t> train_order_{};           /* Stores indexes for training sets. */
+    T weight_{};                             /* k-value. */
+    T bias_{};                               /* m-value. */
+    random::Xorshift32 rng_{};               /* Generator for the training order. */
+    TrainOrder order_{TrainOrder::kShuffled}; /* Training order in stochastic mode. */
+    Optimizer<T> optimizer_{};               /* Adjusts the parameters during training. */
+    Schedule schedule_{};                    /* Learning-rate schedule. */
+    T stochastic_rate_{1};                   /* Derived learning rate for single sets. */
+    T batch_rate_{1};                        /* Derived learning rate for full batches. */
+    T input_mean_{};                         /* Mean of the input values. */
+    T input_scale_{1};                       /* Standard deviation of the input values. */
+    T output_mean_{};                        /* Mean of the reference values. */
+    T output_scale_{1};                      /* Standard deviation of the reference values. */
+    bool standardized_{false};               /* Indicates if the stored data is standardized. */
 
     /********************************************************************************
      * @brief Randomizes the training order before each new epoch. This is done to
      *        prevent that the model is learning due to the order of the training
-     *        sets.
+     *        sets. All orders are equally likely.
      ********************************************************************************/
     void RandomizeTrainingOrder(void);
 
+    /********************************************************************************
+     * @brief Optimizes the model with each training set once, in the order 
+     *        specified by the training order.
+     * 
+     * @param learning_rate
+     *        The learning rate, sets the change rate during errors.
+     ********************************************************************************/
+    void OptimizeStochastic(const T learning_rate);
+
     /********************************************************************************
      * @brief Optimizes the model by making a prediction and adjusting the 
      *        parameters according to the calculated error.
@@ -96,26 +462,118 @@ class LinReg {
      * @param learning_rate
      *        The learning rate, sets the change rate during errors.
      ********************************************************************************/
-    void Optimize(const double input, const double reference, const double learning_rate);
+    void Optimize(const T input, const T reference, const T learning_rate);
+
+    /********************************************************************************
+     * @brief Optimizes the model with the average gradient of a batch of 
+     *        consecutive training sets. The gradient sums are calculated with
+     *        SIMD instructions when available.
+     * 
+     * @param begin
+     *        Index of the first training set of the batch.
+     * @param size
+     *        The number of training sets in the batch.
+     * @param learning_rate
+     *        The learning rate, sets the change rate during errors.
+     ********************************************************************************/
+    void OptimizeBatch(const size_t begin, const size_t size, const T learning_rate);
+
+    /********************************************************************************
+     * @brief Derives the learning rates used when training with a learning rate
+     *        of 0 from the stored input values.
+     ********************************************************************************/
+    void InitAutoLearningRates(void);
+
+    /********************************************************************************
+     * @brief Updates the running mean and sum of squared deviations of a series
+     *        of values with the next value (Welford's method).
+     * 
+     * @param value
+     *        The next value of the series.
+     * @param count
+     *        The number of values including the next value.
+     * @param mean
+     *        Reference to the running mean.
+     * @param sq
+     *        Reference to the running sum of squared deviations from the mean.
+     ********************************************************************************/
+    static void Accumulate(const double value, const size_t count, double& mean, double& sq) {
+        const auto delta{value - mean};
+        mean += delta / count;
+        sq += delta * (value - mean);
+    }
+
+    /********************************************************************************
+     * @brief Standardizes the stored training data and stores the means and
+     *        standard deviations used.
+     * 
+     * @param input_mean
+     *        The mean of the stored input values.
+     * @param output_mean
+     *        The mean of the stored reference values.
+     * @param input_sq
+     *        The sum of squared deviations of the input values from their mean.
+     * @param output_sq
+     *        The sum of squared deviations of the reference values from their mean.
+     ********************************************************************************/
+    void Standardize(const double input_mean, const double output_mean,
+                     const double input_sq, const double output_sq);
+
+    /********************************************************************************
+     * @brief Converts the parameters of the model from the original units to 
+     *        the units of the standardized training data.
+     ********************************************************************************/
+    void ToStandardized(void);
 
     /********************************************************************************
-     * @brief Ensures the the container::Vectors storing the training sets are of equal size. 
-     *        If not, the superfluous values of the larger container::Vector is removed.
+     * @brief Converts the parameters of the model from the units of the 
+     *        standardized training data back to the original units.
      ********************************************************************************/
-    void MatchTrainingSets(void);
+    void FromStandardized(void);
+
+    /********************************************************************************
+     * @brief Trains the model on the stored training data, see Train.
+     * 
+     * @return
+     *        The number of epochs actually trained.
+     ********************************************************************************/
+    size_t TrainEpochs(const size_t num_epochs, const T learning_rate, const TrainMode mode,
+                       const size_t batch_size, const T tolerance, const size_t patience);
 
      /********************************************************************************
      * @brief Initializes the training order container::Vector so that it stores the index of
      *        each training set.
      ********************************************************************************/
     void InitTrainOrderVector(void);
- 
-    /********************************************************************************
-     * @brief Initializes the random generator. This function should preferably be
-     *        called before using the rand function to ensure that the 
-     *        randomized sequence is unique each time the program is run.
-     ********************************************************************************/
-    static void InitRandomGenerator(void);
 };
 
-} /* namespace yrgo */
\ No newline at end of file
+/********************************************************************************
+ * @brief Fits a regression model to referenced training data at compile time 
+ *        with the closed-form least-squares solution. When the result is stored
+ *        as a constexpr variable, the parameters are calculated by the compiler
+ *        and no training is performed at runtime:
+ * 
+ *        static constexpr auto kModel{TrainAtCompileTime(kInputs, kOutputs)};
+ *        model.SetParameters(kModel.Weight(), kModel.Bias());
+ * 
+ * @param train_in
+ *        Reference to array containing input data (x).
+ * @param train_out
+ *        Reference to array containing reference data (y_ref).
+ * @return
+ *        Online model containing the fitted parameters, which yields the same 
+ *        parameters as LinReg::Fit for the same training data.
+ ********************************************************************************/
+template <size_t size>
+constexpr OnlineLinReg TrainAtCompileTime(const double (&train_in)[size], 
+                                          const double (&train_out)[size]) {
+    OnlineLinReg model{};
+    for (size_t i{}; i < size; ++i) {
+        model.Observe(train_in[i], train_out[i]);
+    }
+    return model;
+}
+
+} /* namespace yrgo */
+
+#include <lin_reg_impl.hpp>
\ No newline at end of file
@@ -0,0 +1,70 @@
+/********************************************************************************
+ * @brief Small dense linear algebra routines for solving the normal equations
+ *        of regression models.
+ ********************************************************************************/
+#pragma once
+
+#include <math.h>
+#include <stdlib.h>
+
+namespace yrgo {
+namespace linalg {
+
+/********************************************************************************
+ * @brief Smallest pivot of a Cholesky decomposition relative to the diagonal
+ *        element of the matrix, below which the matrix is considered singular.
+ *        Scaled to the precision of double, which is 32 bits on AVR.
+ ********************************************************************************/
+constexpr double kPivotTolerance{sizeof(double) > 4 ? 1e-12 : 1e-5};
+
+/********************************************************************************
+ * @brief Solves the linear system A * x = b in place via Cholesky decomposition,
+ *        where A is a symmetric positive-definite matrix, for instance X^T * X
+ *        of the normal equations. The decomposition requires n^3 / 6
+ *        multiplications and no pivoting.
+ *
+ * @param a
+ *        Pointer to the n x n matrix A stored in row-major order. Only the lower
+ *        triangle is read and it's overwritten by the Cholesky factor L.
+ * @param b
+ *        Pointer to the right-hand side b of size n, overwritten by the solution x.
+ * @param n
+ *        The number of rows and columns of A.
+ * @return
+ *        True if the system was solved, false if A isn't positive definite (for
+ *        instance if the columns of X are linearly dependent). A pivot smaller
+ *        than kPivotTolerance times the diagonal element is treated as zero.
+ ********************************************************************************/
+inline bool CholeskySolve(double* a, double* b, const size_t n) {
+    for (size_t j{}; j < n; ++j) {
+        auto diagonal{a[j * n + j]};
+        for (size_t k{}; k < j; ++k) {
+            diagonal -= a[j * n + k] * a[j * n + k];
+        }
+        if (!(diagonal > kPivotTolerance * a[j * n + j])) return false;
+        a[j * n + j] = sqrt(diagonal);
+        for (size_t i{j + 1}; i < n; ++i) {
+            auto sum{a[i * n + j]};
+            for (size_t k{}; k < j; ++k) {
+                sum -= a[i * n + k] * a[j * n + k];
+            }
+            a[i * n + j] = sum / a[j * n + j];
+        }
+    }
+    for (size_t i{}; i < n; ++i) {
+        for (size_t k{}; k < i; ++k) {
+            b[i] -= a[i * n + k] * b[k];
+        }
+        b[i] /= a[i * n + i];
+    }
+    for (size_t i{n}; i-- > 0;) {
+        for (size_t k{i + 1}; k < n; ++k) {
+            b[i] -= a[k * n + i] * b[k];
+        }
+        b[i] /= a[i * n + i];
+    }
+    return true;
+}
+
+} /* namespace linalg */
+} /* namespace yrgo */
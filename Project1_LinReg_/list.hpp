@@ -3,15 +3,23 @@
  ********************************************************************************/
 #pragma once
 
-#include <container.hpp>
+#include <allocator.hpp>
 
 namespace yrgo {
 namespace container {
 
 /********************************************************************************
  * @brief Class for implementation of doubly linked lists.
+ *
+ * @tparam T
+ *         The type of the stored elements.
+ * @tparam Allocator
+ *         The allocator policy used for the nodes (default = container::PoolAllocator,
+ *         which carves the nodes from contiguous chunks and releases them all at 
+ *         once when the list is cleared). Use container::HeapAllocator to 
+ *         allocate each node separately on the heap, see allocator.hpp.
  ********************************************************************************/
-template <typename T>
+template <typename T, template <typename> class Allocator = PoolAllocator>
 class List {
     struct Node; /* Struct for storing data in the linked list. */
 
@@ -101,8 +109,9 @@ class List {
     }
 
     /********************************************************************************
-     * @brief Clears content of referenced list by deallocating memory on the
-     *        heap. All member variables are reset to starting values.
+     * @brief Clears content of referenced list by destroying the nodes and
+     *        deallocating their memory, at once if supported by the allocator. 
+     *        All member variables are reset to starting values.
      ********************************************************************************/
     void Clear(void) noexcept {
         RemoveAllNodes();
@@ -212,7 +221,7 @@ class List {
      *        True if the value was added, else false.
      ********************************************************************************/
     bool PushFront(const T& value) noexcept {
-        auto node1{Node::New(value)};
+        auto node1{NewNode(value)};
         if (node1 == nullptr) return false;
         if (size_++ == 0) {
             first_ = node1;
@@ -235,7 +244,7 @@ class List {
      *        True if the value was added, else false.
      ********************************************************************************/
     bool PushBack(const T& value) noexcept {
-        auto node2{Node::New(value)};
+        auto node2{NewNode(value)};
         if (node2 == nullptr) return false;   
         if (size_++ == 0) {
             first_ = node2;
@@ -263,7 +272,7 @@ class List {
         if (iterator == nullptr) {
             return false;
         } else {
-            auto node2{Node::New(value)};
+            auto node2{NewNode(value)};
             if (node2 == nullptr) return false;            
             auto node1{Node::Get(iterator)->previous};
             auto node3{node1->next};
@@ -288,7 +297,7 @@ class List {
             auto node2{node1->next};
             node2->previous = nullptr;
             
-            Node::Delete(node1);
+            DeleteNode(node1);
             first_ = node2;
             size_--;
         }
@@ -306,7 +315,7 @@ class List {
             auto node1{node2->previous};
             node1->next = nullptr;
             
-            Node::Delete(node2);
+            DeleteNode(node2);
             last_ = node1;
             size_--;
         }
@@ -327,13 +336,13 @@ class List {
         if (iterator == nullptr) {
             return false;
         } else {
-            auto node2{iterator.This()};
+            auto node2{Node::Get(iterator)};
             auto node1{node2->previous};
             auto node3{node2->next};
 
             node1->next = node3;
             node3->previous = node1;
-            Node::Delete(node2);
+            DeleteNode(node2);
             size_--;
             return true;
         }
@@ -594,33 +603,6 @@ class List {
         Node* next;     /* Pointer to next next, if any. */
         T data;         /* Data stored by the node. */
 
-        /********************************************************************************
-         * @brief Allocates memory for a new node and stores referenced data.
-         *
-         * @param data
-         *        Data to store in referenced node.
-         * @return
-         *        A pointer to the node if the node was created, else a null pointer.
-         ********************************************************************************/
-        static Node* New(const T& data) noexcept {
-            Node* self{detail::New<Node>()};
-            if (self == nullptr) return nullptr;
-            self->data = data;
-            self->previous = nullptr;
-            self->next = nullptr;
-            return self;
-        }
-
-        /********************************************************************************
-         * @brief Deletes referenced node by deallocating heap allocated memory.
-         *
-         * @param self
-         *        Pointer to the node to delete.
-         ********************************************************************************/
-        static void Delete(Node* self) noexcept {
-            detail::Delete<Node>(self);
-        }
-
         /********************************************************************************
          * @brief Returns a pointer to the node referenced iterator is pointing at.
          *
@@ -646,9 +628,35 @@ class List {
         }
     };
 
-    Node* first_{nullptr}; /* Pointer to the first node of the list. */
-    Node* last_{nullptr};  /* Pointer to the last node of the list. */
-    size_t size_{};        /* The size of the list, i.e. the number of stored elements. */
+    Node* first_{nullptr};        /* Pointer to the first node of the list. */
+    Node* last_{nullptr};         /* Pointer to the last node of the list. */
+    size_t size_{};               /* The size of the list, i.e. the number of stored elements. */
+    Allocator<Node> allocator_{}; /* Allocates the memory of the nodes. */
+
+    /********************************************************************************
+     * @brief Allocates memory for a new node and stores referenced data.
+     *
+     * @param data
+     *        Data to store in the new node.
+     * @return
+     *        A pointer to the node if the node was created, else a null pointer.
+     ********************************************************************************/
+    Node* NewNode(const T& data) noexcept {
+        const auto self{allocator_.Allocate()};
+        if (self == nullptr) return nullptr;
+        return new (self) Node{nullptr, nullptr, data};
+    }
+
+    /********************************************************************************
+     * @brief Destroys referenced node and returns its memory to the allocator.
+     *
+     * @param self
+     *        Pointer to the node to delete.
+     ********************************************************************************/
+    void DeleteNode(Node* self) noexcept {
+        self->~Node();
+        allocator_.Free(self);
+    }
 
     /********************************************************************************
      * @brief Copies referenced values and stored in referenced list. All previous 
@@ -681,8 +689,8 @@ class List {
      ********************************************************************************/
     bool Copy(List& source) noexcept {
         Clear();
-        for (size_t i{}; i < source.Size(); ++i) {
-            if (!PushBack(source[i])) { 
+        for (auto i{source.begin()}; i != source.end(); ++i) {
+            if (!PushBack(*i)) { 
                 return false;
             }
         }
@@ -690,13 +698,26 @@ class List {
     }
 
     /********************************************************************************
-     * @brief Removes all nodes stored in referenced list.
+     * @brief Removes all nodes stored in referenced list. If the allocator supports
+     *        bulk release, the nodes are only visited to call the destructors of
+     *        non-trivial elements, after which all memory is released at once.
      ********************************************************************************/
     void RemoveAllNodes(void) noexcept {
-        for (auto i{begin()}; i != end();) {
-            auto next{Node::Get(i)->next};
-            Node::Delete(Node::Get(i));
-            i = next;
+        if constexpr (Allocator<Node>::kBulkRelease) {
+            if constexpr (!type_traits::is_trivially_copyable<T>::value) {
+                for (auto node{first_}; node != nullptr;) {
+                    const auto next{node->next};
+                    node->~Node();
+                    node = next;
+                }
+            }
+            allocator_.Release();
+        } else {
+            for (auto i{begin()}; i != end();) {
+                auto next{Node::Get(i)->next};
+                DeleteNode(Node::Get(i));
+                i = next;
+            }
         }
     }
 };
@@ -0,0 +1,223 @@
+/********************************************************************************
+ * @brief Log-structured storage of fixed-size records in EEPROM, which spreads
+ *        the writes over the memory to extend its endurance.
+ ********************************************************************************/
+#pragma once
+
+#include <crc.hpp>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace yrgo {
+
+/********************************************************************************
+ * @brief Class for implementing a wear-leveled store of the latest version of a
+ *        record, for instance a serialized model or a counter. Each update is
+ *        written to the next slot of a ring buffer instead of the same address,
+ *        so N slots divide the wear of every EEPROM cell by N:
+ *
+ *        slot = [sequence number (2 bytes)][record][CRC-16 (2 bytes)]
+ *
+ *        The newest slot with a valid checksum holds the current record. A slot
+ *        interrupted by a reset has an invalid checksum, so the previous record
+ *        is kept. Writes are queued and performed by Service, which starts at
+ *        most one byte write per call and never waits for the memory, so the
+ *        caller is never blocked. Bytes already holding the queued value are
+ *        skipped (read-compare-write), and queuing a record equal to the
+ *        current record writes nothing.
+ *
+ * @tparam record_size
+ *         The size of the records in bytes.
+ * @tparam Memory
+ *         The memory policy, which provides the following static methods:
+ *
+ *         bool Ready(void);                 // True if no write is in progress.
+ *         uint8_t ReadByte(uint16_t address);
+ *         void WriteByte(uint16_t address, uint8_t data); // Starts a write.
+ ********************************************************************************/
+template <size_t record_size, typename Memory>
+class LogStore {
+  public:
+    static constexpr size_t kSlotSize{2 + record_size + 2}; /* Bytes per slot. */
+
+    /********************************************************************************
+     * @brief Creates store in specified address range and mounts it, i.e. finds
+     *        the current record.
+     *
+     * @param address
+     *        The first address of the store.
+     * @param size
+     *        The number of bytes of the store, which holds size / kSlotSize slots.
+     ********************************************************************************/
+    LogStore(const uint16_t address, const uint16_t size)
+        : address_{address}
+        , num_slots_{static_cast<uint16_t>(size / kSlotSize)} {
+        Mount();
+    }
+
+    /********************************************************************************
+     * @brief Returns the number of slots of the store.
+     ********************************************************************************/
+    uint16_t NumSlots(void) const { return num_slots_; }
+
+    /********************************************************************************
+     * @brief Indicates if the store holds a valid record.
+     ********************************************************************************/
+    bool Valid(void) const { return valid_; }
+
+    /********************************************************************************
+     * @brief Indicates if a queued record hasn't been written completely yet.
+     ********************************************************************************/
+    bool Pending(void) const { return pending_; }
+
+    /********************************************************************************
+     * @brief Reads the current record, i.e. the record last written completely.
+     *
+     * @param record
+     *        Pointer to storage for the record, which must hold record_size bytes.
+     * @return
+     *        True if the record was read, false if the store holds no valid record.
+     ********************************************************************************/
+    bool Read(uint8_t* record) const {
+        if (!valid_) return false;
+        for (size_t i{}; i < record_size; ++i) {
+            record[i] = Memory::ReadByte(SlotAddress(current_) + 2 + i);
+        }
+        return true;
+    }
+
+    /********************************************************************************
+     * @brief Queues specified record to be written to the next slot by Service.
+     *        A record queued while another is pending replaces it, so only the
+     *        latest record is written.
+     *
+     * @param record
+     *        Pointer to the record to write.
+     * @return
+     *        True if the record was queued or equals the current record, false
+     *        if the store has no slots.
+     ********************************************************************************/
+    bool Write(const uint8_t* record);
+
+    /********************************************************************************
+     * @brief Performs the queued write without blocking, which is intended to be
+     *        called repeatedly, for instance from the main loop. Each call starts
+     *        at most one byte write, since the memory is busy during the write
+     *        (3.3 ms per byte for the ATmega328P EEPROM).
+     *
+     * @return
+     *        True if a write is still pending, else false.
+     ********************************************************************************/
+    bool Service(void);
+
+  private:
+    uint16_t address_;               /* First address of the store. */
+    uint16_t num_slots_;             /* Number of slots. */
+    uint16_t current_{};             /* Slot holding the current record. */
+    uint16_t sequence_{};            /* Sequence number of the current record. */
+    uint16_t target_{};              /* Slot the queued record is written to. */
+    size_t position_{};              /* Next byte of the queued slot to write. */
+    bool valid_{};                   /* Indicates if a current record exists. */
+    bool pending_{};                 /* Indicates if a record is queued. */
+    uint8_t image_[kSlotSize]{};     /* Queued slot. */
+
+    /********************************************************************************
+     * @brief Returns the first address of specified slot.
+     ********************************************************************************/
+    uint16_t SlotAddress(const uint16_t slot) const {
+        return static_cast<uint16_t>(address_ + slot * kSlotSize);
+    }
+
+    /********************************************************************************
+     * @brief Finds the newest slot with a valid checksum.
+     ********************************************************************************/
+    void Mount(void);
+};
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Each slot is read and its checksum verified.
+ *        2. Of the valid slots, the slot with the newest sequence number is
+ *           selected. Sequence numbers are compared with serial number
+ *           arithmetic, i.e. a is newer than b if (int16_t)(a - b) > 0, so the
+ *           wrap-around from 65535 to 0 is handled.
+ ********************************************************************************/
+template <size_t record_size, typename Memory>
+void LogStore<record_size, Memory>::Mount(void) {
+    valid_ = false;
+    for (uint16_t slot{}; slot < num_slots_; ++slot) {
+        uint8_t data[kSlotSize]{};
+        for (size_t i{}; i < kSlotSize; ++i) {
+            data[i] = Memory::ReadByte(SlotAddress(slot) + i);
+        }
+        const auto crc{crc::Crc16(data, kSlotSize - 2)};
+        if (data[kSlotSize - 2] != static_cast<uint8_t>(crc) ||
+            data[kSlotSize - 1] != static_cast<uint8_t>(crc >> 8)) continue;
+        const auto sequence{static_cast<uint16_t>(data[0] | data[1] << 8)};
+        if (!valid_ || static_cast<int16_t>(sequence - sequence_) > 0) {
+            current_ = slot;
+            sequence_ = sequence;
+            valid_ = true;
+        }
+    }
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. If the record equals the current record and no other record is
+ *           pending, nothing is queued.
+ *        2. The slot is assembled in RAM with the next sequence number and
+ *           the checksum last, so the slot isn't valid until completely written.
+ *        3. The slot after the current slot is targeted. If a record is
+ *           already pending, the same slot is targeted and rewritten from the
+ *           start, where the bytes already written are skipped if unchanged.
+ ********************************************************************************/
+template <size_t record_size, typename Memory>
+bool LogStore<record_size, Memory>::Write(const uint8_t* record) {
+    if (num_slots_ == 0) return false;
+    if (valid_ && !pending_) {
+        size_t i{};
+        while (i < record_size && Memory::ReadByte(SlotAddress(current_) + 2 + i) == record[i]) ++i;
+        if (i == record_size) return true;
+    }
+    const auto sequence{static_cast<uint16_t>(sequence_ + 1)};
+    image_[0] = static_cast<uint8_t>(sequence);
+    image_[1] = static_cast<uint8_t>(sequence >> 8);
+    memcpy(image_ + 2, record, record_size);
+    const auto crc{crc::Crc16(image_, kSlotSize - 2)};
+    image_[kSlotSize - 2] = static_cast<uint8_t>(crc);
+    image_[kSlotSize - 1] = static_cast<uint8_t>(crc >> 8);
+    target_ = valid_ ? static_cast<uint16_t>((current_ + 1) % num_slots_) : 0;
+    position_ = 0;
+    pending_ = true;
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. If the memory is busy, the call returns immediately.
+ *        2. Bytes already holding the queued value are skipped by reading them,
+ *           which only takes a few cycles, until a byte differs. The write of
+ *           that byte is started and the call returns.
+ *        3. Once all bytes are written, the target slot becomes the current slot.
+ ********************************************************************************/
+template <size_t record_size, typename Memory>
+bool LogStore<record_size, Memory>::Service(void) {
+    if (!pending_ || !Memory::Ready()) return pending_;
+    while (position_ < kSlotSize) {
+        const auto address{static_cast<uint16_t>(SlotAddress(target_) + position_)};
+        const auto data{image_[position_++]};
+        if (Memory::ReadByte(address) != data) {
+            Memory::WriteByte(address, data);
+            return true;
+        }
+    }
+    current_ = target_;
+    sequence_ = static_cast<uint16_t>(image_[0] | image_[1] << 8);
+    valid_ = true;
+    pending_ = false;
+    return false;
+}
+
+} /* namespace yrgo */
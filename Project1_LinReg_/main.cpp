@@ -5,15 +5,43 @@
  ********************************************************************************/
 #include <drivers.hpp> 
 #include <lin_reg.hpp>
+#include <lookup_table.hpp>
 
 using namespace yrgo::driver;
 using namespace yrgo::container;
 
+/********************************************************************************
+ * @brief Training data for the temperature model, where the input is the sensor
+ *        voltage and the output is the corresponding temperature. The model is
+ *        fitted at compile time, so no training is performed at startup.
+ ********************************************************************************/
+static constexpr double kTrainIn[]{0.0, 1.0, 2.0, 3.0, 4.0};
+static constexpr double kTrainOut[]{-50.0, 50.0, 150.0, 250.0, 350.0};
+static constexpr auto kTrainedModel{yrgo::TrainAtCompileTime(kTrainIn, kTrainOut)};
+static constexpr double kWeight{kTrainedModel.Weight()};
+static constexpr double kBias{kTrainedModel.Bias()};
+static_assert(kTrainedModel.Fitted(), "Training data must contain at least two different inputs!");
+
+/********************************************************************************
+ * @brief Scalar type used for prediction. Q16.16 fixed point is used, since
+ *        floating-point arithmetic is emulated in software on the ATmega328P.
+ ********************************************************************************/
+using Scalar = yrgo::fixed::Q16_16;
+
+/********************************************************************************
+ * @brief Model input (voltage) corresponding to one ADC code.
+ ********************************************************************************/
+static constexpr double kInputScale{5.0 / adc::kMaxVal};
+
 /********************************************************************************
  * @brief Devices and models used in the embedded system.
  *
  * @param model
  *        Linear regression model for predicting the room temperature.
+ * @param temp_table
+ *        Lookup table mapping each ADC code to the temperature predicted by
+ *        the model. Generated at compile time and must be regenerated via
+ *        temp_table.Generate(model, kInputScale) if the model is updated.
  * @param button1
  *        Button used to toggle the temperature.
  * @param timer0
@@ -22,27 +50,24 @@ using namespace yrgo::container;
  * @param timer1
  *        Timer used to toggle the temperature every 60s when enabled.
  ********************************************************************************/
-static yrgo::LinReg model{};
+static yrgo::LinReg<Scalar> model{Scalar{kWeight}, Scalar{kBias}};
+static yrgo::LookupTable<> temp_table{kWeight, kBias, kInputScale};
 static GPIO button1{13, GPIO::Direction::kInputPullup};
 static Timer timer0{Timer::Circuit::k0, 300};
 static Timer timer1{Timer::Circuit::k1, 60000};
 
+namespace {
+
 /********************************************************************************
- * @brief Read the analog voltage from pin A2 and convert it to a voltage in the range of 
- *        0 to 5 volts.
+ * @brief Read the analog voltage from pin A2 as a 10-bit ADC code.
  *
- *			 Use the pre-trained linear regression model ('model') to 
- *		    predict the temperature based on the voltage reading.
+ *			 Look up the temperature predicted by the pre-trained linear regression 
+ *		    model ('model') for the ADC code in the lookup table ('temp_table').
  *
  *			 Print the predicted temperature to the serial monitor, rounded to the nearest integer.
  ********************************************************************************/
-
-namespace {
-
 void PredictTemp(void){
-	const auto uin= adc::Read(adc::Pin::A2) / 1023.0 * 5; 
-	const auto predicted_temp = model.Predict(uin);
-	serial::Printf("Temp: %d\n", utils::Round(predicted_temp));
+	serial::Printf("Temp: %d\n", temp_table.Lookup(adc::Read(adc::Pin::A2)));
 }
 
 /********************************************************************************
@@ -90,11 +115,6 @@ void Timer1Callback(void) {
  ********************************************************************************/
 inline void Setup(void) {
 
-	const Vector<double> inputs{{0.0, 1.0, 2.0, 3.0, 4.0}};
-	const Vector<double> outputs{{-50.0, 50.0, 150.0, 250.0, 350.0}};
-	model.LoadTrainingData(inputs, outputs);
-	model.Train(1000);
-	
 	serial::Init();
 	PredictTemp();
 	timer1.Start();
@@ -0,0 +1,312 @@
+/********************************************************************************
+ * @brief Optimizers for training linear regression models with gradient
+ *        descent. The optimizers are used as policies, i.e. the optimizer is a
+ *        template parameter of the model, so that each update is inlined without
+ *        virtual dispatch:
+ *
+ *        yrgo::LinReg<double, yrgo::optimizer::Adam> model{inputs, outputs};
+ *
+ *        Each optimizer provides the following methods:
+ *
+ *        void Update(T& weight, T& bias, const T weight_descent,
+ *                    const T bias_descent, const T learning_rate);
+ *        void Reset(void);
+ *
+ *        where the descents are the negative gradients of the squared error,
+ *        i.e. error * x for the weight and error for the bias.
+ ********************************************************************************/
+#pragma once
+
+#include <math.h>
+#include <type_traits.hpp>
+
+namespace yrgo {
+namespace optimizer {
+
+/********************************************************************************
+ * @brief Class for implementing plain stochastic gradient descent, where the
+ *        parameters are adjusted with the descent multiplied by the learning
+ *        rate. No state is stored.
+ *
+ * @tparam T
+ *         The scalar type of the model.
+ ********************************************************************************/
+template <typename T>
+class Sgd {
+  public:
+
+    /********************************************************************************
+     * @brief Adjusts specified parameters as p = p + LR * descent.
+     *
+     * @param weight
+     *        Reference to the weight (k-value) of the model.
+     * @param bias
+     *        Reference to the bias (m-value) of the model.
+     * @param weight_descent
+     *        The negative gradient of the weight (error * x).
+     * @param bias_descent
+     *        The negative gradient of the bias (error).
+     * @param learning_rate
+     *        The learning rate, sets the change rate during errors.
+     ********************************************************************************/
+    void Update(T& weight, T& bias, const T weight_descent,
+                const T bias_descent, const T learning_rate) {
+        bias += bias_descent * learning_rate;
+        weight += weight_descent * learning_rate;
+    }
+
+    /********************************************************************************
+     * @brief Resets the state of the optimizer (no state is stored).
+     ********************************************************************************/
+    void Reset(void) {}
+};
+
+/********************************************************************************
+ * @brief Class for implementing gradient descent with momentum, where the
+ *        parameters are adjusted with a velocity accumulating the previous
+ *        descents. The velocity speeds up progress along consistent directions,
+ *        for instance on badly scaled training data.
+ *
+ * @tparam T
+ *         The scalar type of the model.
+ ********************************************************************************/
+template <typename T>
+class Momentum {
+  public:
+
+    /********************************************************************************
+     * @brief Creates optimizer with specified momentum.
+     *
+     * @param momentum
+     *        The fraction of the velocity kept each update (default = 0.9).
+     ********************************************************************************/
+    explicit Momentum(const T momentum = T{0.9})
+        : momentum_{momentum} {}
+
+    /********************************************************************************
+     * @brief Adjusts specified parameters as v = mu * v + descent, p = p + LR * v.
+     *
+     * @param weight
+     *        Reference to the weight (k-value) of the model.
+     * @param bias
+     *        Reference to the bias (m-value) of the model.
+     * @param weight_descent
+     *        The negative gradient of the weight (error * x).
+     * @param bias_descent
+     *        The negative gradient of the bias (error).
+     * @param learning_rate
+     *        The learning rate, sets the change rate during errors.
+     ********************************************************************************/
+    void Update(T& weight, T& bias, const T weight_descent,
+                const T bias_descent, const T learning_rate) {
+        weight_velocity_ = momentum_ * weight_velocity_ + weight_descent;
+        bias_velocity_ = momentum_ * bias_velocity_ + bias_descent;
+        bias += bias_velocity_ * learning_rate;
+        weight += weight_velocity_ * learning_rate;
+    }
+
+    /********************************************************************************
+     * @brief Resets the velocities of the optimizer.
+     ********************************************************************************/
+    void Reset(void) { weight_velocity_ = bias_velocity_ = T{}; }
+
+  protected:
+    T momentum_;            /* Fraction of the velocity kept each update. */
+    T weight_velocity_{};   /* Accumulated descent of the weight. */
+    T bias_velocity_{};     /* Accumulated descent of the bias. */
+};
+
+/********************************************************************************
+ * @brief Class for implementing gradient descent with Nesterov momentum, where
+ *        the parameters are adjusted with the velocity as it will be after the
+ *        next update (look-ahead), which dampens the overshoot of plain momentum.
+ *
+ * @tparam T
+ *         The scalar type of the model.
+ ********************************************************************************/
+template <typename T>
+class Nesterov : public Momentum<T> {
+  public:
+
+    /********************************************************************************
+     * @brief Creates optimizer with specified momentum.
+     *
+     * @param momentum
+     *        The fraction of the velocity kept each update (default = 0.9).
+     ********************************************************************************/
+    explicit Nesterov(const T momentum = T{0.9})
+        : Momentum<T>{momentum} {}
+
+    /********************************************************************************
+     * @brief Adjusts specified parameters as v = mu * v + descent,
+     *        p = p + LR * (descent + mu * v).
+     *
+     * @param weight
+     *        Reference to the weight (k-value) of the model.
+     * @param bias
+     *        Reference to the bias (m-value) of the model.
+     * @param weight_descent
+     *        The negative gradient of the weight (error * x).
+     * @param bias_descent
+     *        The negative gradient of the bias (error).
+     * @param learning_rate
+     *        The learning rate, sets the change rate during errors.
+     ********************************************************************************/
+    void Update(T& weight, T& bias, const T weight_descent,
+                const T bias_descent, const T learning_rate) {
+        const auto mu{this->momentum_};
+        this->weight_velocity_ = mu * this->weight_velocity_ + weight_descent;
+        this->bias_velocity_ = mu * this->bias_velocity_ + bias_descent;
+        bias += (bias_descent + mu * this->bias_velocity_) * learning_rate;
+        weight += (weight_descent + mu * this->weight_velocity_) * learning_rate;
+    }
+};
+
+/********************************************************************************
+ * @brief Class for implementing AdaGrad, where the learning rate of each
+ *        parameter is divided by the root of its accumulated squared descents.
+ *        Parameters with large gradients (such as the weight when the inputs
+ *        are large) therefore take smaller steps. Only floating-point types are
+ *        supported, since a square root is calculated each update.
+ *
+ * @tparam T
+ *         The scalar type of the model.
+ ********************************************************************************/
+template <typename T>
+class AdaGrad {
+    static_assert(type_traits::is_floating_point<T>::value,
+                  "AdaGrad requires a floating-point type!");
+  public:
+
+    /********************************************************************************
+     * @brief Creates optimizer with specified smoothing term.
+     *
+     * @param epsilon
+     *        Small value preventing division by zero (default = 1e-8).
+     ********************************************************************************/
+    explicit AdaGrad(const T epsilon = T{1e-8})
+        : epsilon_{epsilon} {}
+
+    /********************************************************************************
+     * @brief Adjusts specified parameters as G = G + descent^2,
+     *        p = p + LR * descent / (sqrt(G) + epsilon).
+     *
+     * @param weight
+     *        Reference to the weight (k-value) of the model.
+     * @param bias
+     *        Reference to the bias (m-value) of the model.
+     * @param weight_descent
+     *        The negative gradient of the weight (error * x).
+     * @param bias_descent
+     *        The negative gradient of the bias (error).
+     * @param learning_rate
+     *        The learning rate, sets the change rate during errors.
+     ********************************************************************************/
+    void Update(T& weight, T& bias, const T weight_descent,
+                const T bias_descent, const T learning_rate) {
+        weight_squares_ += weight_descent * weight_descent;
+        bias_squares_ += bias_descent * bias_descent;
+        bias += learning_rate * bias_descent / (sqrt(bias_squares_) + epsilon_);
+        weight += learning_rate * weight_descent / (sqrt(weight_squares_) + epsilon_);
+    }
+
+    /********************************************************************************
+     * @brief Resets the accumulated squared descents of the optimizer.
+     ********************************************************************************/
+    void Reset(void) { weight_squares_ = bias_squares_ = T{}; }
+
+  private:
+    T epsilon_;            /* Smoothing term preventing division by zero. */
+    T weight_squares_{};   /* Accumulated squared descents of the weight. */
+    T bias_squares_{};     /* Accumulated squared descents of the bias. */
+};
+
+/********************************************************************************
+ * @brief Class for implementing Adam, where each parameter is adjusted with
+ *        the running average of its descents divided by the root of the running
+ *        average of its squared descents. The averages are bias-corrected, since
+ *        they start at zero. Only floating-point types are supported, since a
+ *        square root is calculated each update.
+ *
+ * @tparam T
+ *         The scalar type of the model.
+ ********************************************************************************/
+template <typename T>
+class Adam {
+    static_assert(type_traits::is_floating_point<T>::value,
+                  "Adam requires a floating-point type!");
+  public:
+
+    /********************************************************************************
+     * @brief Creates optimizer with specified decay rates.
+     *
+     * @param beta1
+     *        The decay rate of the average descents (default = 0.9).
+     * @param beta2
+     *        The decay rate of the average squared descents (default = 0.999).
+     * @param epsilon
+     *        Small value preventing division by zero (default = 1e-8).
+     ********************************************************************************/
+    explicit Adam(const T beta1 = T{0.9}, const T beta2 = T{0.999}, const T epsilon = T{1e-8})
+        : beta1_{beta1}
+        , beta2_{beta2}
+        , epsilon_{epsilon} {}
+
+    /********************************************************************************
+     * @brief Adjusts specified parameters as m = b1 * m + (1 - b1) * descent,
+     *        v = b2 * v + (1 - b2) * descent^2,
+     *        p = p + LR * m' / (sqrt(v') + epsilon), where m' and v' are the
+     *        bias-corrected averages.
+     *
+     * @param weight
+     *        Reference to the weight (k-value) of the model.
+     * @param bias
+     *        Reference to the bias (m-value) of the model.
+     * @param weight_descent
+     *        The negative gradient of the weight (error * x).
+     * @param bias_descent
+     *        The negative gradient of the bias (error).
+     * @param learning_rate
+     *        The learning rate, sets the change rate during errors.
+     ********************************************************************************/
+    void Update(T& weight, T& bias, const T weight_descent,
+                const T bias_descent, const T learning_rate) {
+        beta1_power_ *= beta1_;
+        beta2_power_ *= beta2_;
+        const auto rate{learning_rate * sqrt(1 - beta2_power_) / (1 - beta1_power_)};
+        UpdateParameter(bias, bias_mean_, bias_square_, bias_descent, rate);
+        UpdateParameter(weight, weight_mean_, weight_square_, weight_descent, rate);
+    }
+
+    /********************************************************************************
+     * @brief Resets the running averages of the optimizer.
+     ********************************************************************************/
+    void Reset(void) {
+        weight_mean_ = weight_square_ = bias_mean_ = bias_square_ = T{};
+        beta1_power_ = beta2_power_ = 1;
+    }
+
+  private:
+    T beta1_;             /* Decay rate of the average descents. */
+    T beta2_;             /* Decay rate of the average squared descents. */
+    T epsilon_;           /* Smoothing term preventing division by zero. */
+    T beta1_power_{1};    /* beta1^t for bias correction, where t is the number of updates. */
+    T beta2_power_{1};    /* beta2^t for bias correction. */
+    T weight_mean_{};     /* Average descent of the weight. */
+    T weight_square_{};   /* Average squared descent of the weight. */
+    T bias_mean_{};       /* Average descent of the bias. */
+    T bias_square_{};     /* Average squared descent of the bias. */
+
+    /********************************************************************************
+     * @brief Updates the averages of a single parameter and adjusts it with the
+     *        specified bias-corrected learning rate.
+     ********************************************************************************/
+    void UpdateParameter(T& parameter, T& mean, T& square, const T descent, const T rate) {
+        mean = beta1_ * mean + (1 - beta1_) * descent;
+        square = beta2_ * square + (1 - beta2_) * descent * descent;
+        parameter += rate * mean / (sqrt(square) + epsilon_ * sqrt(1 - beta2_power_));
+    }
+};
+
+} /* namespace optimizer */
+} /* namespace yrgo */
@@ -0,0 +1,237 @@
+/********************************************************************************
+ * @brief Library for implementing piecewise-linear regression models in C++,
+ *        i.e. models approximating non-linear responses with several lines.
+ ********************************************************************************/
+#pragma once
+
+#include <lin_reg.hpp>
+#include <fixed_point.hpp>
+#include <stdlib.h>
+
+namespace yrgo {
+
+/********************************************************************************
+ * @brief Class for implementing piecewise-linear regression models. The input
+ *        range of the training data is split into uniform segments, each
+ *        predicting with a linear regression model of its own:
+ *
+ *                           y_pred = k[s] * x + m[s],
+ *
+ *        where s = floor((x - min(x)) / segment width) is the segment of the
+ *        input. The segment is calculated in O(1) without searching, so each
+ *        prediction only requires one multiplication and a truncation in
+ *        addition to the multiply-add of a single line.
+ *
+ *        The segments are trained independently on the training sets within
+ *        their part of the input range, see ParallelTrainer to fit them in
+ *        parallel. Adjacent segments aren't forced to meet at their boundary.
+ *        Inputs outside the input range of the training data are predicted
+ *        with the first or last segment.
+ *
+ * @tparam num_segments
+ *         The number of segments.
+ * @tparam T
+ *         The scalar type used for training and prediction (default = double).
+ * @tparam Optimizer
+ *         The optimizer used to train each segment (default = plain stochastic
+ *         gradient descent).
+ ********************************************************************************/
+template <size_t num_segments, typename T = double,
+          template <typename> class Optimizer = optimizer::Sgd>
+class PiecewiseLinReg {
+    static_assert(num_segments > 0, "At least one segment is required!");
+  public:
+    using Segment = LinReg<T, Optimizer>; /* Model of each segment. */
+
+    /********************************************************************************
+     * @brief Default constructor, creates empty regression model.
+     ********************************************************************************/
+    PiecewiseLinReg(void) = default;
+
+    /********************************************************************************
+     * @brief Creates new regression model and distributes referenced training
+     *        data to the segments.
+     *
+     * @param train_in
+     *        Reference to container::Vector containing input data (x).
+     * @param train_out
+     *        Reference to container::Vector containing reference data (y_ref).
+     * @param standardize
+     *        Indicates if the training data of each segment shall be standardized
+     *        (default = false), see LinReg::LoadTrainingData.
+     ********************************************************************************/
+    PiecewiseLinReg(const container::Vector<T>& train_in, const container::Vector<T>& train_out,
+                    const bool standardize = false) {
+        LoadTrainingData(train_in, train_out, standardize);
+    }
+
+    /********************************************************************************
+     * @brief Makes a prediction with the segment of specified input value.
+     *
+     * @param input
+     *        The input value (x) to predict with.
+     * @return
+     *        The predicted value (y_pred).
+     ********************************************************************************/
+    T Predict(const T input) const { return segments_[SegmentIndex(input)].Predict(input); }
+
+    /********************************************************************************
+     * @brief Returns the index of the segment of specified input value, clamped
+     *        to the first and last segment. The position is clamped before it's
+     *        truncated, so inputs far outside the range (or infinite) are safe.
+     *
+     * @param input
+     *        The input value (x).
+     * @return
+     *        The index of the segment.
+     ********************************************************************************/
+    size_t SegmentIndex(const T input) const {
+        const T position{(input - min_) * inverse_width_};
+        if (!(position > T{})) return 0;
+        if (!(position < static_cast<T>(static_cast<double>(num_segments)))) return num_segments - 1;
+        return static_cast<size_t>(fixed::Truncate(position));
+    }
+
+    /********************************************************************************
+     * @brief Loads training data from referenced container::Vectors. The input
+     *        range of the training data is split into the segments, after which
+     *        each training set is loaded into the segment of its input value.
+     *
+     * @param train_in
+     *        Reference to container::Vector containing input data (x).
+     * @param train_out
+     *        Reference to container::Vector containing reference data (y_ref).
+     * @param standardize
+     *        Indicates if the training data of each segment shall be standardized
+     *        (default = false).
+     * @return
+     *        True if the training data was loaded, false if memory allocation
+     *        failed while splitting the training data (the model is unchanged).
+     ********************************************************************************/
+    bool LoadTrainingData(const container::Vector<T>& train_in,
+                          const container::Vector<T>& train_out,
+                          const bool standardize = false);
+
+    /********************************************************************************
+     * @brief Trains each segment with specified parameters, see LinReg::Train.
+     *
+     * @return
+     *        The maximum number of epochs trained by any segment.
+     ********************************************************************************/
+    size_t Train(const size_t num_epochs, const T learning_rate = T{0.01},
+                 const TrainMode mode = TrainMode::kStochastic, const size_t batch_size = 32,
+                 const T tolerance = T{}, const size_t patience = 1) {
+        size_t max_epochs{};
+        for (auto& segment : segments_) {
+            const auto epochs{segment.Train(num_epochs, learning_rate, mode, batch_size,
+                                            tolerance, patience)};
+            if (epochs > max_epochs) max_epochs = epochs;
+        }
+        return max_epochs;
+    }
+
+    /********************************************************************************
+     * @brief Fits each segment with the closed-form least-squares solution.
+     *
+     * @return
+     *        True if all segments were fitted, false if any segment doesn't
+     *        contain at least two different input values (that segment is unchanged).
+     ********************************************************************************/
+    bool Fit(void) {
+        auto fitted{true};
+        for (auto& segment : segments_) {
+            if (!segment.Fit()) fitted = false;
+        }
+        return fitted;
+    }
+
+    /********************************************************************************
+     * @brief Returns reference to the model of specified segment, for instance
+     *        to set its parameters or optimizer.
+     ********************************************************************************/
+    Segment& GetSegment(const size_t index) { return segments_[index]; }
+
+    /********************************************************************************
+     * @brief Returns reference to the model of specified segment.
+     ********************************************************************************/
+    const Segment& GetSegment(const size_t index) const { return segments_[index]; }
+
+    /********************************************************************************
+     * @brief Returns the number of segments.
+     ********************************************************************************/
+    static constexpr size_t NumSegments(void) { return num_segments; }
+
+    /********************************************************************************
+     * @brief Sets the input range split into the segments, for instance when the
+     *        segment parameters are loaded from EEPROM.
+     *
+     * @param min
+     *        The lower limit of the first segment.
+     * @param max
+     *        The upper limit of the last segment.
+     ********************************************************************************/
+    void SetRange(const T min, const T max) {
+        const auto width{static_cast<double>(max) - static_cast<double>(min)};
+        min_ = min;
+        inverse_width_ = static_cast<T>(width > 0 ? num_segments / width : 0.0);
+    }
+
+  private:
+    Segment segments_[num_segments]{}; /* Models of the segments. */
+    T min_{};                          /* Lower limit of the first segment. */
+    T inverse_width_{};                /* Number of segments per unit of input. */
+};
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The minimum and maximum input are searched for to set the range. If
+ *           no training data is specified, the range is reset and every segment
+ *           is cleared, so no stale training data is kept.
+ *        2. The training sets of each segment are counted, so the training data
+ *           of each segment is allocated once with its exact size.
+ *        3. Each training set is copied into the training data of its segment,
+ *           which is then moved into the model of the segment. Hence every
+ *           value is copied once.
+ *        4. If an allocation fails, the previous range is restored before
+ *           returning, since no segment has been loaded yet.
+ ********************************************************************************/
+template <size_t num_segments, typename T, template <typename> class Optimizer>
+bool PiecewiseLinReg<num_segments, T, Optimizer>::LoadTrainingData(const container::Vector<T>& train_in,
+                                                                   const container::Vector<T>& train_out,
+                                                                   const bool standardize) {
+    const auto num_sets{train_in.Size() < train_out.Size() ? train_in.Size() : train_out.Size()};
+    T min{}, max{};
+    if (num_sets > 0) min = max = train_in[0];
+    for (size_t i{1}; i < num_sets; ++i) {
+        if (train_in[i] < min) min = train_in[i];
+        if (train_in[i] > max) max = train_in[i];
+    }
+    const auto previous_min{min_}, previous_inverse_width{inverse_width_};
+    SetRange(min, max);
+
+    size_t counts[num_segments]{};
+    for (size_t i{}; i < num_sets; ++i) {
+        ++counts[SegmentIndex(train_in[i])];
+    }
+    container::Vector<T> inputs[num_segments]{}, outputs[num_segments]{};
+    for (size_t s{}; s < num_segments; ++s) {
+        if (!inputs[s].Resize(counts[s]) || !outputs[s].Resize(counts[s])) {
+            min_ = previous_min;
+            inverse_width_ = previous_inverse_width;
+            return false;
+        }
+        counts[s] = 0;
+    }
+    for (size_t i{}; i < num_sets; ++i) {
+        const auto s{SegmentIndex(train_in[i])};
+        inputs[s][counts[s]] = train_in[i];
+        outputs[s][counts[s]++] = train_out[i];
+    }
+    for (size_t s{}; s < num_segments; ++s) {
+        segments_[s].LoadTrainingData(static_cast<container::Vector<T>&&>(inputs[s]),
+                                      static_cast<container::Vector<T>&&>(outputs[s]), standardize);
+    }
+    return true;
+}
+
+} /* namespace yrgo */
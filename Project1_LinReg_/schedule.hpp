@@ -0,0 +1,132 @@
+/********************************************************************************
+ * @brief Learning-rate schedules, which adjust the learning rate between the
+ *        epochs of a training session.
+ ********************************************************************************/
+#pragma once
+
+#include <math.h>
+#include <stdlib.h>
+
+namespace yrgo {
+
+/********************************************************************************
+ * @brief Class for implementing learning-rate schedules. The learning rate of
+ *        each epoch is calculated from the base learning rate passed to the
+ *        training and the index of the epoch, starting at 0:
+ *
+ *        constant:     lr = base
+ *        step:         lr = base * decay^floor(epoch / step)
+ *        exponential:  lr = base * decay^epoch
+ *        cosine:       lr = base * (1 + cos(pi * epoch / period)) / 2,
+ *                      after which lr = 0
+ *        inverse time: lr = base / (1 + decay * epoch)
+ *
+ *        Schedules are created with the static factory methods, for instance
+ *        Schedule::Exponential(0.99).
+ ********************************************************************************/
+class Schedule {
+  public:
+
+    /********************************************************************************
+     * @brief Enumeration of schedule types.
+     ********************************************************************************/
+    enum class Type { kConstant, kStep, kExponential, kCosine, kInverseTime };
+
+    /********************************************************************************
+     * @brief Default constructor, creates constant schedule.
+     ********************************************************************************/
+    constexpr Schedule(void) = default;
+
+    /********************************************************************************
+     * @brief Returns schedule keeping the base learning rate for all epochs.
+     ********************************************************************************/
+    static constexpr Schedule Constant(void) { return Schedule{}; }
+
+    /********************************************************************************
+     * @brief Returns schedule multiplying the learning rate with specified decay
+     *        every step epochs.
+     *
+     * @param decay
+     *        The factor to multiply the learning rate with, e.g. 0.5.
+     * @param step
+     *        The number of epochs between each decay.
+     ********************************************************************************/
+    static constexpr Schedule Step(const double decay, const size_t step) {
+        return Schedule{Type::kStep, decay, step > 0 ? step : 1};
+    }
+
+    /********************************************************************************
+     * @brief Returns schedule multiplying the learning rate with specified decay
+     *        every epoch.
+     *
+     * @param decay
+     *        The factor to multiply the learning rate with, e.g. 0.99.
+     ********************************************************************************/
+    static constexpr Schedule Exponential(const double decay) {
+        return Schedule{Type::kExponential, decay, 1};
+    }
+
+    /********************************************************************************
+     * @brief Returns schedule decreasing the learning rate from the base rate to
+     *        0 along half a cosine period.
+     *
+     * @param period
+     *        The number of epochs until the learning rate reaches 0.
+     ********************************************************************************/
+    static constexpr Schedule Cosine(const size_t period) {
+        return Schedule{Type::kCosine, 0.0, period > 0 ? period : 1};
+    }
+
+    /********************************************************************************
+     * @brief Returns schedule dividing the base learning rate by 1 + decay * epoch.
+     *
+     * @param decay
+     *        The decay rate, e.g. 0.01.
+     ********************************************************************************/
+    static constexpr Schedule InverseTime(const double decay) {
+        return Schedule{Type::kInverseTime, decay, 1};
+    }
+
+    /********************************************************************************
+     * @brief Returns the type of the schedule.
+     ********************************************************************************/
+    constexpr Type GetType(void) const { return type_; }
+
+    /********************************************************************************
+     * @brief Returns the learning rate of specified epoch.
+     *
+     * @param base_rate
+     *        The base learning rate.
+     * @param epoch
+     *        The index of the epoch, starting at 0.
+     * @return
+     *        The learning rate of the epoch.
+     ********************************************************************************/
+    double Rate(const double base_rate, const size_t epoch) const {
+        switch (type_) {
+            case Type::kStep:
+                return base_rate * pow(decay_, static_cast<double>(epoch / step_));
+            case Type::kExponential:
+                return base_rate * pow(decay_, static_cast<double>(epoch));
+            case Type::kCosine:
+                return epoch < step_ ?
+                    base_rate * 0.5 * (1.0 + cos(M_PI * epoch / step_)) : 0.0;
+            case Type::kInverseTime:
+                return base_rate / (1.0 + decay_ * epoch);
+            default:
+                return base_rate;
+        }
+    }
+
+  private:
+    Type type_{Type::kConstant}; /* Type of schedule. */
+    double decay_{1.0};          /* Decay factor or rate. */
+    size_t step_{1};             /* Epochs per step (step) or period (cosine). */
+
+    constexpr Schedule(const Type type, const double decay, const size_t step)
+        : type_{type}
+        , decay_{decay}
+        , step_{step} {}
+};
+
+} /* namespace yrgo */
@@ -0,0 +1,555 @@
+/********************************************************************************
+ * @brief Implementation of small-buffer-optimized container::SmallVectors of
+ *        any data type.
+ ********************************************************************************/
+#pragma once
+
+#include <container.hpp>
+#include <stdint.h>
+
+namespace yrgo {
+namespace container {
+
+/********************************************************************************
+ * @brief Class for implementation of dynamic container::SmallVectors, which
+ *        store up to N elements inline, i.e. within the object itself. Small
+ *        container::SmallVectors hence require no heap allocation and don't
+ *        fragment the heap. Beyond N elements, the elements are moved to the
+ *        heap, where the capacity grows by 50 % like for container::Vector.
+ *        The API is the same as for container::Vector.
+ *
+ *        Classes storing their data in a container taking the element type only,
+ *        such as LinReg, can use a container::SmallVector via an alias template:
+ *
+ *        template <typename T>
+ *        using SmallBuffer = container::SmallVector<T, 8>;
+ *        LinReg<double, optimizer::Sgd, SmallBuffer> model{};
+ *
+ * @tparam T
+ *         The type of the stored elements.
+ * @tparam N
+ *         The number of elements stored inline.
+ ********************************************************************************/
+template <typename T, size_t N>
+class SmallVector {
+    static_assert(N > 0, "At least one inline element is required!");
+  public:
+
+    /********************************************************************************
+     * @brief Default constructor, creates empty container::SmallVector.
+     ********************************************************************************/
+    SmallVector(void) noexcept = default;
+
+    /********************************************************************************
+     * @brief Creates container::SmallVector of specified size.
+     *
+     * @param size
+     *        The size of the container::SmallVector, i.e. the number of elements it holds.
+     ********************************************************************************/
+    explicit SmallVector(const size_t size) noexcept {
+        Resize(size);
+    }
+
+    /********************************************************************************
+     * @brief Creates container::SmallVector containing referenced values.
+     *
+     * @param values
+     *        Reference to the values to store in newly created container::SmallVector.
+     ********************************************************************************/
+    template <size_t size>
+    SmallVector(const T (&values)[size]) noexcept {
+        AddValues(values);
+    }
+
+    /********************************************************************************
+     * @brief Creates container::SmallVector as a copy of referenced source.
+     *
+     * @param source
+     *        Reference to container::SmallVector whose content is copied.
+     ********************************************************************************/
+    SmallVector(const SmallVector& source) noexcept {
+        AddValues(source);
+    }
+
+    /********************************************************************************
+     * @brief Move constructor, moves content from referenced source to assigned
+     *        container::SmallVector. The source is emptied after the move operation
+     *        is performed.
+     *
+     * @param source
+     *        Reference to container::SmallVector whose content is moved.
+     ********************************************************************************/
+    SmallVector(SmallVector&& source) noexcept {
+        MoveFrom(source);
+    }
+
+    /********************************************************************************
+     * @brief Destructor, destroys the elements and clears memory allocated on the heap.
+     ********************************************************************************/
+    ~SmallVector(void) noexcept { Clear(); }
+
+    /********************************************************************************
+     * @brief Index operator, returns reference to the element at specified index.
+     *
+     * @param index
+     *        Index to searched element.
+     * @return
+     *        A reference to the element at specified index.
+     ********************************************************************************/
+    T& operator[](const size_t index) noexcept {
+        return data_[index];
+    }
+
+    /********************************************************************************
+     * @brief Index operator, returns reference to the element at specified index.
+     *
+     * @param index
+     *        Index to searched element.
+     * @return
+     *        A reference to the element at specified index.
+     ********************************************************************************/
+    const T& operator[](const size_t index) const noexcept {
+        return data_[index];
+    }
+
+    /********************************************************************************
+     * @brief Assignment operator, copies referenced values to assigned
+     *        container::SmallVector. Previous values are cleared before copying.
+     *
+     * @param values
+     *        Referenced values to copy.
+     ********************************************************************************/
+    template <size_t size>
+    void operator=(const T (&values)[size]) noexcept {
+        Clear();
+        AddValues(values);
+    }
+
+    /********************************************************************************
+     * @brief Assignment operator, copies the content of referenced container::SmallVector
+     *        to assigned container::SmallVector. Previous values are cleared before copying.
+     *
+     * @param source
+     *        Reference to container::SmallVector containing the the values to copy.
+     ********************************************************************************/
+    void operator=(const SmallVector& source) noexcept {
+        if (&source == this) return;
+        Clear();
+        AddValues(source);
+    }
+
+    /********************************************************************************
+     * @brief Move assignment operator, moves content from referenced source to
+     *        assigned container::SmallVector. Previous values are cleared before
+     *        moving and the source is emptied after the move operation is performed.
+     *
+     * @param source
+     *        Reference to container::SmallVector whose content is moved.
+     ********************************************************************************/
+    void operator=(SmallVector&& source) noexcept {
+        if (&source == this) return;
+        Clear();
+        MoveFrom(source);
+    }
+
+    /********************************************************************************
+     * @brief Addition operator, pushes referenced values to the back of the
+     *        container::SmallVector.
+     *
+     * @param values
+     *        Reference to the values to add.
+     ********************************************************************************/
+    template <size_t size>
+    void operator+=(const T (&values)[size]) noexcept {
+        AddValues(values);
+    }
+
+    /********************************************************************************
+     * @brief Adds values from referenced container::SmallVector to the back of assigned
+     *        container::SmallVector.
+     *
+     * @param source
+     *        Reference to container::SmallVector containing the the values to add.
+     ********************************************************************************/
+    void operator+=(const SmallVector& source) noexcept {
+        AddValues(source);
+    }
+
+    /********************************************************************************
+     * @brief Returns a pointer to the stored elements, which are stored inline if
+     *        the capacity doesn't exceed N.
+     *
+     * @return
+     *        A pointer to the memory block containing stored elements.
+     ********************************************************************************/
+    T* Data(void) noexcept {
+        return data_;
+    }
+
+    /********************************************************************************
+     * @brief Returns a pointer to the stored elements, which are stored inline if
+     *        the capacity doesn't exceed N.
+     *
+     * @return
+     *        A pointer to the memory block containing stored elements.
+     ********************************************************************************/
+    const T* Data(void) const noexcept {
+        return data_;
+    }
+
+    /********************************************************************************
+     * @brief Returns the size of referenced container::SmallVector, i.e. the number of
+     *        elements it holds.
+     *
+     * @return
+     *        The size of the container::SmallVector as the number of elements it holds.
+     ********************************************************************************/
+    size_t Size(void) const noexcept {
+        return size_;
+    }
+
+    /********************************************************************************
+     * @brief Returns the capacity of referenced container::SmallVector, i.e. the number
+     *        of elements it can hold without reallocation (at least N).
+     *
+     * @return
+     *        The capacity of the container::SmallVector as the number of elements.
+     ********************************************************************************/
+    size_t Capacity(void) const noexcept {
+        return capacity_;
+    }
+
+    /********************************************************************************
+     * @brief Checks if referenced container::SmallVector is empty.
+     *
+     * @return
+     *        True if referenced container::SmallVector is empty, else false.
+     ********************************************************************************/
+    bool Empty(void) const noexcept {
+        return size_ == 0 ? true : false;
+    }
+
+    /********************************************************************************
+     * @brief Returns the start address of referenced container::SmallVector.
+     *
+     * @return
+     *        A pointer to the first element of referenced container::SmallVector.
+     ********************************************************************************/
+    T* begin(void) noexcept { return data_; }
+
+    /********************************************************************************
+     * @brief Returns the start address of referenced container::SmallVector.
+     *
+     * @return
+     *        A pointer to the first element of referenced container::SmallVector.
+     ********************************************************************************/
+    const T* begin(void) const noexcept { return data_; }
+
+    /********************************************************************************
+     * @brief Returns the end address of referenced container::SmallVector.
+     *
+     * @return
+     *        A pointer to the address after the last element.
+     ********************************************************************************/
+    T* end(void) noexcept { return data_ + size_; }
+
+    /********************************************************************************
+     * @brief Returns the end address of referenced container::SmallVector.
+     *
+     * @return
+     *        A pointer to the address after the last element.
+     ********************************************************************************/
+    const T* end(void) const noexcept { return data_ + size_; }
+
+    /********************************************************************************
+     * @brief Returns the address of the last element stored in referenced
+     *        container::SmallVector.
+     *
+     * @return
+     *        A pointer to the last element, or a null pointer if empty.
+     ********************************************************************************/
+    T* last(void) noexcept { return size_ > 0 ? end() - 1 : nullptr; }
+
+    /********************************************************************************
+     * @brief Returns the address of the last element stored in referenced
+     *        container::SmallVector.
+     *
+     * @return
+     *        A pointer to the last element, or a null pointer if empty.
+     ********************************************************************************/
+    const T* last(void) const noexcept { return size_ > 0 ? end() - 1 : nullptr; }
+
+    /********************************************************************************
+     * @brief Clears content of referenced container::SmallVector by destroying the
+     *        elements and deallocating memory on the heap, if any. The elements
+     *        are stored inline afterwards.
+     ********************************************************************************/
+    void Clear(void) noexcept {
+        detail::Destroy<T>(data_, size_);
+        if (OnHeap()) free(data_);
+        data_ = Inline();
+        size_ = 0;
+        capacity_ = N;
+    }
+
+    /********************************************************************************
+     * @brief Resizes referenced container::SmallVector to specified new size. Memory
+     *        is only allocated if the new size exceeds the capacity, in which case
+     *        exactly new_size elements are allocated on the heap. Added elements
+     *        are default initialized and removed elements are destroyed, but
+     *        shrinking keeps the capacity, see ShrinkToFit.
+     *
+     * @param new_size
+     *        The new size of the container::SmallVector.
+     * @return
+     *        True if the container::SmallVector was resized, else false.
+     ********************************************************************************/
+    bool Resize(const size_t new_size) noexcept {
+        if (new_size < size_) {
+            detail::Destroy<T>(data_ + new_size, size_ - new_size);
+        } else {
+            if (!Reserve(new_size)) return false;
+            for (size_t i{size_}; i < new_size; ++i) {
+                new (data_ + i) T;
+            }
+        }
+        size_ = new_size;
+        return true;
+    }
+
+    /********************************************************************************
+     * @brief Reserves memory for at least specified number of elements, so that
+     *        the container::SmallVector can grow to this size without further
+     *        reallocations. Nothing is allocated if the capacity is sufficient,
+     *        in particular not for up to N elements. The size is unchanged.
+     *
+     * @param capacity
+     *        The number of elements to reserve memory for.
+     * @return
+     *        True if the memory was reserved, false if the memory allocation failed.
+     ********************************************************************************/
+    bool Reserve(const size_t capacity) noexcept;
+
+    /********************************************************************************
+     * @brief Releases unused heap capacity. The elements are moved back inline if
+     *        they fit, else the capacity is reduced to the size via relocation.
+     *
+     * @return
+     *        True if the unused capacity was released, else false.
+     ********************************************************************************/
+    bool ShrinkToFit(void) noexcept;
+
+    /********************************************************************************
+     * @brief Pushes new value to the back of referenced container::SmallVector.
+     *
+     * @param value
+     *        Reference to the new value to push.
+     * @return
+     *        True if the value was pushed to the back, else false.
+     ********************************************************************************/
+    bool PushBack(const T& value) noexcept {
+        return EmplaceBack(value);
+    }
+
+    /********************************************************************************
+     * @brief Pushes new value to the back of referenced container::SmallVector by
+     *        moving it.
+     *
+     * @param value
+     *        Reference to the new value to move.
+     * @return
+     *        True if the value was pushed to the back, else false.
+     ********************************************************************************/
+    bool PushBack(T&& value) noexcept {
+        return EmplaceBack(detail::Move(value));
+    }
+
+    /********************************************************************************
+     * @brief Constructs new value in place at the back of referenced container::SmallVector.
+     *
+     * @param args
+     *        Arguments forwarded to the constructor of the new value.
+     * @return
+     *        True if the value was constructed at the back, else false.
+     ********************************************************************************/
+    template <typename... Args>
+    bool EmplaceBack(Args&&... args) noexcept {
+        if (size_ == capacity_) return GrowAndEmplaceBack(detail::Forward<Args>(args)...);
+        new (data_ + size_) T(detail::Forward<Args>(args)...);
+        ++size_;
+        return true;
+    }
+
+    /********************************************************************************
+     * @brief Pops value at the back of referenced container::SmallVector. The capacity
+     *        is kept, see ShrinkToFit.
+     *
+     * @return
+     *        True if the last value was popped, else false.
+     ********************************************************************************/
+    bool PopBack(void) noexcept {
+        if (size_ > 0) data_[--size_].~T();
+        return true;
+    }
+
+  private:
+    alignas(T) uint8_t buffer_[sizeof(T) * N]; /* Inline storage, left uninitialized. */
+    T* data_{reinterpret_cast<T*>(buffer_)};   /* Pointer to the inline storage or heap block. */
+    size_t size_{};                            /* The number of elements it holds. */
+    size_t capacity_{N};                       /* The number of elements it can hold. */
+
+    /********************************************************************************
+     * @brief Returns a pointer to the inline storage.
+     ********************************************************************************/
+    T* Inline(void) noexcept { return reinterpret_cast<T*>(buffer_); }
+
+    /********************************************************************************
+     * @brief Indicates if the elements are stored on the heap.
+     ********************************************************************************/
+    bool OnHeap(void) const noexcept { return capacity_ > N; }
+
+    /********************************************************************************
+     * @brief Moves the content of referenced source to the empty container::SmallVector.
+     *        A heap block is taken over, while inline elements are moved one by one.
+     *        The source is emptied afterwards.
+     *
+     * @param source
+     *        Reference to container::SmallVector whose content is moved.
+     ********************************************************************************/
+    void MoveFrom(SmallVector& source) noexcept {
+        if (source.OnHeap()) {
+            data_ = source.data_;
+            capacity_ = source.capacity_;
+            source.data_ = source.Inline();
+            source.capacity_ = N;
+        } else {
+            detail::MoveConstruct<T>(source.data_, data_, source.size_);
+        }
+        size_ = source.size_;
+        source.size_ = 0;
+    }
+
+    /********************************************************************************
+     * @brief Reserves memory for at least specified number of elements. If the
+     *        capacity is exceeded, it grows by 50 % or to the required size if larger.
+     *
+     * @param required
+     *        The number of elements the container::SmallVector must be able to hold.
+     * @return
+     *        True if the memory was reserved, false if the memory allocation failed.
+     ********************************************************************************/
+    bool Grow(const size_t required) noexcept {
+        if (required <= capacity_) return true;
+        const auto capacity{capacity_ + capacity_ / 2};
+        return Reserve(capacity < required ? required : capacity);
+    }
+
+    /********************************************************************************
+     * @brief Grows the full container::SmallVector and constructs new value at the back.
+     *        Kept apart from EmplaceBack so that its common path is inlined.
+     *
+     * @param args
+     *        Arguments forwarded to the constructor of the new value.
+     * @return
+     *        True if the value was constructed at the back, else false.
+     ********************************************************************************/
+    template <typename... Args>
+    bool GrowAndEmplaceBack(Args&&... args) noexcept {
+        T value(detail::Forward<Args>(args)...);
+        if (!Grow(size_ + 1)) return false;
+        new (data_ + size_) T(detail::Move(value));
+        ++size_;
+        return true;
+    }
+
+    /********************************************************************************
+     * @brief Adds referenced values to the back of the container::SmallVector.
+     *
+     * @param values
+     *        Reference to values to copy and add to the back.
+     * @return
+     *        True if the values were added, else false.
+     ********************************************************************************/
+    template <size_t size>
+    bool AddValues(const T (&values)[size]) noexcept {
+        if (!Grow(size_ + size)) return false;
+        Append(values, size);
+        return true;
+    }
+
+    /********************************************************************************
+     * @brief Adds values from referenced source to the back of the container::SmallVector.
+     *
+     * @param source
+     *        Reference to container::SmallVector whose content is copied and added.
+     * @return
+     *        True if the values were added, else false.
+     ********************************************************************************/
+    bool AddValues(const SmallVector& source) noexcept {
+        if (!Grow(size_ + source.size_)) return false;
+        Append(source.data_, source.size_);
+        return true;
+    }
+
+    /********************************************************************************
+     * @brief Copy constructs specified number of values at the back of the
+     *        container::SmallVector, whose capacity must already be sufficient.
+     *
+     * @param values
+     *        Pointer to the values to copy.
+     * @param count
+     *        The number of values to copy.
+     ********************************************************************************/
+    void Append(const T* values, const size_t count) noexcept {
+        for (size_t i{}; i < count; ++i) {
+            new (data_ + size_ + i) T(values[i]);
+        }
+        size_ += count;
+    }
+};
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Heap blocks are relocated, i.e. reallocated for trivially copyable
+ *           types, see detail::Relocate.
+ *        2. When leaving the inline storage, a heap block is allocated and the
+ *           inline elements are moved into it.
+ ********************************************************************************/
+template <typename T, size_t N>
+bool SmallVector<T, N>::Reserve(const size_t capacity) noexcept {
+    if (capacity <= capacity_) return true;
+    const auto block{OnHeap() ? detail::Relocate<T>(data_, size_, capacity)
+                              : detail::New<T>(capacity)};
+    if (block == nullptr) return false;
+    if (!OnHeap()) detail::MoveConstruct<T>(data_, block, size_);
+    data_ = block;
+    capacity_ = capacity;
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Inline elements are already stored without unused heap capacity.
+ *        2. If the elements fit inline, they are moved back into the inline
+ *           storage and the heap block is deallocated.
+ *        3. Else the heap block is relocated to the size of the container.
+ ********************************************************************************/
+template <typename T, size_t N>
+bool SmallVector<T, N>::ShrinkToFit(void) noexcept {
+    if (!OnHeap() || size_ == capacity_) return true;
+    if (size_ <= N) {
+        detail::MoveConstruct<T>(data_, Inline(), size_);
+        free(data_);
+        data_ = Inline();
+        capacity_ = N;
+        return true;
+    }
+    const auto block{detail::Relocate<T>(data_, size_, size_)};
+    if (block == nullptr) return false;
+    data_ = block;
+    capacity_ = size_;
+    return true;
+}
+
+} /* namespace container */
+} /* namespace yrgo */
@@ -0,0 +1,80 @@
+/********************************************************************************
+ * @brief Training loop shared by the regression models, which runs the epochs
+ *        and stops the training early once the model has converged.
+ ********************************************************************************/
+#pragma once
+
+#include <stdlib.h>
+
+namespace yrgo {
+namespace detail {
+
+/********************************************************************************
+ * @brief Returns the absolute difference between specified values.
+ *
+ * @param a
+ *        The first value.
+ * @param b
+ *        The second value.
+ * @return
+ *        The absolute difference |a - b|.
+ ********************************************************************************/
+template <typename T>
+constexpr T Distance(const T a, const T b) { return a < b ? b - a : a - b; }
+
+/********************************************************************************
+ * @brief Returns the summed absolute difference between specified arrays.
+ *
+ * @param a
+ *        Pointer to the first array.
+ * @param b
+ *        Pointer to the second array.
+ * @param size
+ *        The number of values in each array.
+ * @return
+ *        The sum of |a[i] - b[i]|.
+ ********************************************************************************/
+template <typename T>
+T Distance(const T* a, const T* b, const size_t size) {
+    T sum{};
+    for (size_t i{}; i < size; ++i) {
+        sum += Distance(a[i], b[i]);
+    }
+    return sum;
+}
+
+/********************************************************************************
+ * @brief Trains a model during specified number of epochs. The training is
+ *        stopped early once the change of the parameters has been within the
+ *        tolerance for patience consecutive epochs.
+ *
+ * @param num_epochs
+ *        The maximum number of epochs to train.
+ * @param tolerance
+ *        The summed absolute change of the parameters during an epoch, at or
+ *        below which the epoch counts as converged.
+ * @param patience
+ *        The number of consecutive converged epochs required to stop early.
+ * @param train_epoch
+ *        Callable training one epoch, which is passed the index of the epoch
+ *        (starting at 0) and returns the summed absolute change of the
+ *        parameters during the epoch.
+ * @return
+ *        The number of epochs actually trained.
+ ********************************************************************************/
+template <typename T, typename EpochFunc>
+size_t TrainEpochs(const size_t num_epochs, const T tolerance, const size_t patience,
+                   EpochFunc train_epoch) {
+    size_t stable_epochs{};
+    for (size_t epoch{}; epoch < num_epochs; ++epoch) {
+        if (train_epoch(epoch) <= tolerance) {
+            if (++stable_epochs >= patience) return epoch + 1;
+        } else {
+            stable_epochs = 0;
+        }
+    }
+    return num_epochs;
+}
+
+} /* namespace detail */
+} /* namespace yrgo */
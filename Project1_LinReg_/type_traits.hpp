@@ -145,5 +145,46 @@ struct is_arithmetic {
     static const bool value{is_integral<T>::value || is_floating_point<T>::value};
 };
 
+/********************************************************************************
+ * @brief Indicates if specified type T is trivially copyable, i.e. if objects
+ *        of the type can be copied and relocated bytewise, for instance via
+ *        memcpy or realloc. The compiler intrinsic is used, since the check
+ *        can't be implemented in the language itself.
+ *
+ * @param value
+ *        Constant set to true for trivially copyable types, false for others.
+ ********************************************************************************/
+template <typename T>
+struct is_trivially_copyable {
+    static const bool value{__is_trivially_copyable(T)};
+};
+
+/********************************************************************************
+ * @brief Removes the reference of specified type T, if any.
+ *
+ * @param type
+ *        The type T without reference.
+ ********************************************************************************/
+template <typename T>
+struct remove_reference {
+    using type = T;
+};
+
+/********************************************************************************
+ * @brief Removes the lvalue reference of specified type T&.
+ ********************************************************************************/
+template <typename T>
+struct remove_reference<T&> {
+    using type = T;
+};
+
+/********************************************************************************
+ * @brief Removes the rvalue reference of specified type T&&.
+ ********************************************************************************/
+template <typename T>
+struct remove_reference<T&&> {
+    using type = T;
+};
+
 } /* namespace type_traits */
 } /* namespace yrgo */
\ No newline at end of file
@@ -217,6 +217,30 @@ inline void GlobalInterruptEnable(void) { asm("SEI"); }
  ********************************************************************************/
 inline void GlobalInterruptDisable(void) { asm("CLI"); }
 
+/********************************************************************************
+ * @brief Disables interrupts globally and returns the previous status register,
+ *        so that the previous interrupt state can be restored via
+ *        RestoreInterrupts. Unlike GlobalInterruptEnable, interrupts are not
+ *        enabled at the end of a critical section entered with interrupts disabled,
+ *        for instance within an interrupt service routine.
+ *
+ * @return
+ *        The status register before interrupts were disabled.
+ ********************************************************************************/
+inline uint8_t SaveAndDisableInterrupts(void) {
+    const uint8_t status{SREG};
+    GlobalInterruptDisable();
+    return status;
+}
+
+/********************************************************************************
+ * @brief Restores the interrupt state saved via SaveAndDisableInterrupts.
+ *
+ * @param status
+ *        The status register returned by SaveAndDisableInterrupts.
+ ********************************************************************************/
+inline void RestoreInterrupts(const uint8_t status) { SREG = status; }
+
 /********************************************************************************
  * @brief Rounds the specified number to the nearest integer.
  *
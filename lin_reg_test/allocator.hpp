@@ -0,0 +1,219 @@
+/********************************************************************************
+ * @brief Allocator policies for containers allocating one element at a time,
+ *        such as the nodes of container::List.
+ *
+ *        An allocator policy is a class template taking the element type T,
+ *        which provides the following methods:
+ *
+ *        T* Allocate(void);   // Uninitialized memory for one element, or null.
+ *        void Free(T* block); // Returns memory obtained from Allocate.
+ *        void Release(void);  // Frees all memory at once, if kBulkRelease.
+ *
+ *        static constexpr bool kBulkRelease; // True if Release frees all
+ *                                            // elements, so that they don't
+ *                                            // need to be freed one by one.
+ ********************************************************************************/
+#pragma once
+
+#include "container.hpp"
+#include <stdint.h>
+
+namespace yrgo {
+namespace container {
+
+/********************************************************************************
+ * @brief Allocator policy allocating each element separately on the heap.
+ *
+ * @tparam T
+ *         The type of the allocated elements.
+ ********************************************************************************/
+template <typename T>
+class HeapAllocator {
+  public:
+    static constexpr bool kBulkRelease{false}; /* Elements must be freed one by one. */
+
+    /********************************************************************************
+     * @brief Allocates memory for one element on the heap.
+     *
+     * @return
+     *        A pointer to the uninitialized element, or a null pointer if the
+     *        memory allocation failed.
+     ********************************************************************************/
+    T* Allocate(void) noexcept { return detail::New<T>(1); }
+
+    /********************************************************************************
+     * @brief Deallocates referenced element.
+     *
+     * @param block
+     *        Pointer to the element to deallocate.
+     ********************************************************************************/
+    void Free(T* block) noexcept { detail::Delete<T>(block); }
+
+    /********************************************************************************
+     * @brief Does nothing, since the elements are deallocated one by one.
+     ********************************************************************************/
+    void Release(void) noexcept {}
+};
+
+/********************************************************************************
+ * @brief Allocator policy carving elements from contiguous chunks, which
+ *        avoids the overhead of the heap allocator per element (typically
+ *        2 - 4 bytes on AVR), fragmentation of the heap and elements scattered
+ *        over the memory. Freed elements are kept in a free list and reused,
+ *        so allocating and freeing an element is O(1). All chunks are
+ *        deallocated at once via Release.
+ *
+ *        The first chunk holds kMinChunkSize elements and each new chunk holds
+ *        twice as many as the previous one, up to kMaxChunkSize elements, so
+ *        the number of heap allocations grows logarithmically with the number
+ *        of elements.
+ *
+ * @tparam T
+ *         The type of the allocated elements.
+ ********************************************************************************/
+template <typename T>
+class PoolAllocator {
+  public:
+    static constexpr bool kBulkRelease{true};  /* All elements are freed by Release. */
+    static constexpr size_t kMinChunkSize{4};  /* Elements in the first chunk. */
+    static constexpr size_t kMaxChunkSize{64}; /* Maximum number of elements per chunk. */
+
+    /********************************************************************************
+     * @brief Default constructor, creates empty pool. No memory is allocated
+     *        until the first element is allocated.
+     ********************************************************************************/
+    PoolAllocator(void) noexcept = default;
+
+    /********************************************************************************
+     * @brief Deleted copy constructor, since the chunks are owned by the pool.
+     ********************************************************************************/
+    PoolAllocator(const PoolAllocator&) = delete;
+
+    /********************************************************************************
+     * @brief Deleted assignment operator, since the chunks are owned by the pool.
+     ********************************************************************************/
+    PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+    /********************************************************************************
+     * @brief Destructor, deallocates all chunks.
+     ********************************************************************************/
+    ~PoolAllocator(void) noexcept { Release(); }
+
+    /********************************************************************************
+     * @brief Allocates memory for one element from the pool.
+     *
+     * @return
+     *        A pointer to the uninitialized element, or a null pointer if a new
+     *        chunk was required and the memory allocation failed.
+     ********************************************************************************/
+    T* Allocate(void) noexcept {
+        if (free_ != nullptr) {
+            const auto slot{free_};
+            free_ = slot->next;
+            return reinterpret_cast<T*>(slot);
+        }
+        if (unused_ == end_ && !AddChunk()) return nullptr;
+        return reinterpret_cast<T*>(unused_++);
+    }
+
+    /********************************************************************************
+     * @brief Returns referenced element to the pool for reuse. The memory stays
+     *        allocated until Release is called.
+     *
+     * @param block
+     *        Pointer to the element to free, obtained from this pool.
+     ********************************************************************************/
+    void Free(T* block) noexcept {
+        const auto slot{reinterpret_cast<Slot*>(block)};
+        slot->next = free_;
+        free_ = slot;
+    }
+
+    /********************************************************************************
+     * @brief Deallocates all chunks at once. All elements allocated from the
+     *        pool become invalid, so their destructors must have been called.
+     ********************************************************************************/
+    void Release(void) noexcept;
+
+    /********************************************************************************
+     * @brief Returns the number of chunks allocated on the heap.
+     ********************************************************************************/
+    size_t NumChunks(void) const noexcept { return num_chunks_; }
+
+  private:
+
+    /********************************************************************************
+     * @brief Storage of one element, which links to the next free slot while free.
+     ********************************************************************************/
+    union Slot {
+        Slot* next;                         /* Next free slot, if any. */
+        alignas(T) uint8_t data[sizeof(T)]; /* Storage of the element. */
+    };
+
+    /********************************************************************************
+     * @brief Header of a chunk, followed by the slots of the chunk.
+     ********************************************************************************/
+    struct alignas(Slot) Chunk {
+        Chunk* next; /* Previously allocated chunk, if any. */
+    };
+
+    Chunk* chunks_{nullptr};           /* Most recently allocated chunk. */
+    Slot* free_{nullptr};              /* First slot of the free list. */
+    Slot* unused_{nullptr};            /* First never used slot of the newest chunk. */
+    Slot* end_{nullptr};               /* End of the newest chunk. */
+    size_t chunk_size_{kMinChunkSize}; /* Number of slots of the next chunk. */
+    size_t num_chunks_{};              /* Number of allocated chunks. */
+
+    /********************************************************************************
+     * @brief Allocates a new chunk, whose slots are handed out in order.
+     *
+     * @return
+     *        True if the chunk was allocated, else false.
+     ********************************************************************************/
+    bool AddChunk(void) noexcept;
+};
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The chunk is allocated as a header followed by chunk_size_ slots.
+ *           The header is aligned as a slot, so the slots are aligned too.
+ *        2. The slots aren't linked into the free list. Instead, they are
+ *           handed out in order by Allocate, so no loop is required.
+ *        3. The chunks are linked into a list, so that Release can find them.
+ ********************************************************************************/
+template <typename T>
+bool PoolAllocator<T>::AddChunk(void) noexcept {
+    const auto chunk{static_cast<Chunk*>(malloc(sizeof(Chunk) + sizeof(Slot) * chunk_size_))};
+    if (chunk == nullptr) return false;
+    chunk->next = chunks_;
+    chunks_ = chunk;
+    unused_ = reinterpret_cast<Slot*>(chunk + 1);
+    end_ = unused_ + chunk_size_;
+    if (chunk_size_ < kMaxChunkSize) chunk_size_ *= 2;
+    ++num_chunks_;
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The chunks are deallocated by traversing the list of chunks, i.e.
+ *           one deallocation per chunk instead of one per element.
+ *        2. All member variables are reset, so the next chunk holds
+ *           kMinChunkSize elements again.
+ ********************************************************************************/
+template <typename T>
+void PoolAllocator<T>::Release(void) noexcept {
+    while (chunks_ != nullptr) {
+        const auto next{chunks_->next};
+        free(chunks_);
+        chunks_ = next;
+    }
+    free_ = nullptr;
+    unused_ = nullptr;
+    end_ = nullptr;
+    chunk_size_ = kMinChunkSize;
+    num_chunks_ = 0;
+}
+
+} /* namespace container */
+} /* namespace yrgo */
@@ -3,8 +3,19 @@
  ********************************************************************************/
 #pragma once
 
+#include "type_traits.hpp"
 #include <stdlib.h>
 
+#if __has_include(<new>)
+#include <new>
+#else
+/********************************************************************************
+ * @brief Placement new, constructs an object at specified address. Declared
+ *        here since the AVR toolchain provides no <new> header.
+ ********************************************************************************/
+inline void* operator new(size_t, void* address) noexcept { return address; }
+#endif
+
 namespace yrgo {
 namespace container {
 namespace detail {
@@ -54,19 +65,100 @@ inline void Delete(T* &block) {
 }
 
 /********************************************************************************
- * @brief Moves memory from specified source to a copy. The source no longer
- *        has ownership after the move is performed, i.e. the source is emptied.
+ * @brief Casts referenced value to an rvalue reference, so that its content is
+ *        moved instead of copied when passed to a constructor or assignment
+ *        operator. The source no longer has ownership after the move.
  *
- * @param source
- *        Reference to the source whose memory is moved.
+ * @param value
+ *        Reference to the value to move.
  * @return 
- *        The copy of the source.
+ *        An rvalue reference to the value.
+ ********************************************************************************/
+template <typename T>
+inline typename type_traits::remove_reference<T>::type&& Move(T&& value) noexcept {
+    return static_cast<typename type_traits::remove_reference<T>::type&&>(value);
+}
+
+/********************************************************************************
+ * @brief Forwards referenced argument with its original value category, i.e.
+ *        rvalues are moved and lvalues are copied.
+ *
+ * @param value
+ *        Reference to the argument to forward.
+ * @return 
+ *        A reference to the argument of the original value category.
+ ********************************************************************************/
+template <typename T>
+inline T&& Forward(typename type_traits::remove_reference<T>::type& value) noexcept {
+    return static_cast<T&&>(value);
+}
+
+/********************************************************************************
+ * @brief Destroys specified number of elements of referenced block without
+ *        deallocating the block. Nothing is done for trivially destructible types.
+ *
+ * @param block
+ *        Pointer to the first element to destroy.
+ * @param size
+ *        The number of elements to destroy.
+ ********************************************************************************/
+template <typename T>
+inline void Destroy(T* block, const size_t size) {
+    for (size_t i{}; i < size; ++i) {
+        block[i].~T();
+    }
+}
+
+/********************************************************************************
+ * @brief Move constructs specified number of elements from referenced source
+ *        into uninitialized memory, after which the source elements are destroyed.
+ *
+ * @param source
+ *        Pointer to the first element to move.
+ * @param destination
+ *        Pointer to uninitialized memory for the moved elements, which must not
+ *        overlap the source.
+ * @param size
+ *        The number of elements to move.
+ ********************************************************************************/
+template <typename T>
+inline void MoveConstruct(T* source, T* destination, const size_t size) {
+    for (size_t i{}; i < size; ++i) {
+        new (destination + i) T(Move(source[i]));
+    }
+    Destroy<T>(source, size);
+}
+
+/********************************************************************************
+ * @brief Relocates the elements of referenced heap allocated block to a block
+ *        of specified new size. Trivially copyable types are relocated via
+ *        reallocation, which may extend the block in place. Other types are
+ *        move constructed into a new block, after which the old elements are
+ *        destroyed and the old block is deallocated.
+ *
+ * @param block
+ *        The block to relocate.
+ * @param size
+ *        The number of constructed elements of the block, which must not
+ *        exceed the new size.
+ * @param new_size
+ *        The new size of the allocated block, i.e. the number of elements it 
+ *        can hold after relocation.
+ * @return
+ *        A pointer to the relocated block at success, else a null pointer
+ *        (the old block is unchanged).
  ********************************************************************************/
 template <typename T>
-inline T Move(T&& source) {
-    T copy{source};
-    source = {};
-    return copy;
+inline T* Relocate(T* block, const size_t size, const size_t new_size) {
+    if constexpr (type_traits::is_trivially_copyable<T>::value) {
+        return Resize<T>(block, new_size);
+    } else {
+        auto copy{New<T>(new_size)};
+        if (copy == nullptr) return nullptr;
+        MoveConstruct<T>(block, copy, size);
+        free(block);
+        return copy;
+    }
 }
 
 } /* namespace */
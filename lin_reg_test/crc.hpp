@@ -0,0 +1,45 @@
+/********************************************************************************
+ * @brief Cyclic redundancy checks for detecting corrupted data, for instance
+ *        data stored in EEPROM.
+ ********************************************************************************/
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace yrgo {
+namespace crc {
+
+/********************************************************************************
+ * @brief Initial value of the CRC-16 checksum.
+ ********************************************************************************/
+constexpr uint16_t kCrc16Init{0xFFFF};
+
+/********************************************************************************
+ * @brief Calculates the CRC-16/CCITT-FALSE checksum (polynomial 0x1021) of
+ *        specified bytes. The checksum is calculated bit by bit, which requires
+ *        no lookup table in program memory. Checksums of consecutive blocks can
+ *        be calculated by passing the checksum of the previous block as crc.
+ *
+ * @param data
+ *        Pointer to the bytes to check.
+ * @param size
+ *        The number of bytes to check.
+ * @param crc
+ *        The initial value of the checksum (default = 0xFFFF).
+ * @return
+ *        The checksum of the bytes.
+ ********************************************************************************/
+constexpr uint16_t Crc16(const uint8_t* data, const size_t size, uint16_t crc = kCrc16Init) {
+    for (size_t i{}; i < size; ++i) {
+        crc ^= static_cast<uint16_t>(data[i] << 8);
+        for (uint8_t bit{}; bit < 8; ++bit) {
+            crc = crc & 0x8000 ? static_cast<uint16_t>((crc << 1) ^ 0x1021)
+                               : static_cast<uint16_t>(crc << 1);
+        }
+    }
+    return crc;
+}
+
+} /* namespace crc */
+} /* namespace yrgo */
@@ -0,0 +1,414 @@
+/********************************************************************************
+ * @brief Benchmarking linear regression model implementation with Google 
+ *        Benchmark.
+ ********************************************************************************/
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include "lin_reg.hpp"
+#include "parallel_trainer.hpp"
+#include "multi_lin_reg.hpp"
+#include "poly_reg.hpp"
+#include "piecewise_lin_reg.hpp"
+#include "list.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define READ_CYCLES() __rdtsc()
+#else
+#define READ_CYCLES() 0ULL
+#endif
+
+using namespace yrgo;
+
+namespace {
+
+/********************************************************************************
+ * @brief Creates training data for y = 100x - 50 with specified scalar type.
+ * 
+ * @param inputs
+ *        Reference to vector storing the input data (x).
+ * @param outputs
+ *        Reference to vector storing the reference data (y_ref).
+ ********************************************************************************/
+template <typename T>
+void CreateTrainingData(container::Vector<T>& inputs, container::Vector<T>& outputs) {
+    for (std::size_t i{}; i < 5; ++i) {
+        inputs.PushBack(T{static_cast<double>(i)});
+        outputs.PushBack(T{100.0 * i - 50.0});
+    }
+}
+
+/********************************************************************************
+ * @brief Sets the number of time-stamp counter cycles per iteration of 
+ *        specified benchmark.
+ * 
+ * @param state
+ *        Reference to the benchmark state.
+ * @param start
+ *        The time-stamp counter at the start of the benchmark.
+ ********************************************************************************/
+void SetCyclesPerIteration(benchmark::State& state, const unsigned long long start) {
+    state.counters["cycles"] = benchmark::Counter(static_cast<double>(READ_CYCLES() - start), 
+                                                  benchmark::Counter::kAvgIterations);
+}
+
+/********************************************************************************
+ * @brief Measures a single prediction with specified scalar type.
+ ********************************************************************************/
+template <typename T>
+void BM_Predict(benchmark::State& state) {
+    const LinReg<T> model{T{100.0}, T{-50.0}};
+    T input{1.5};
+    const auto start{READ_CYCLES()};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(input);
+        benchmark::DoNotOptimize(model.Predict(input));
+    }
+    SetCyclesPerIteration(state, start);
+}
+
+/********************************************************************************
+ * @brief Measures a single prediction of a cubic model with specified scalar
+ *        type, evaluated with Horner's scheme.
+ ********************************************************************************/
+template <typename T>
+void BM_PolyPredict(benchmark::State& state) {
+    const T coefficients[]{T{25.0}, T{1.0}, T{-2.0}, T{0.5}};
+    PolyReg<3, T> model{};
+    model.SetParameters(coefficients, T{2.5}, T{0.4});
+    T input{1.5};
+    const auto start{READ_CYCLES()};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(input);
+        benchmark::DoNotOptimize(model.Predict(input));
+    }
+    SetCyclesPerIteration(state, start);
+}
+
+/********************************************************************************
+ * @brief Measures a single prediction of the same cubic model evaluated term
+ *        by term, where each power is calculated with a multiplication loop.
+ ********************************************************************************/
+template <typename T>
+void BM_PolyPredictPowers(benchmark::State& state) {
+    const T coefficients[]{T{25.0}, T{1.0}, T{-2.0}, T{0.5}};
+    T input{1.5};
+    const auto start{READ_CYCLES()};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(input);
+        const T t{(input - T{2.5}) * T{0.4}};
+        T sum{};
+        for (std::size_t i{}; i < 4; ++i) {
+            T power{1.0};
+            for (std::size_t j{}; j < i; ++j) {
+                benchmark::DoNotOptimize(power *= t);
+            }
+            sum += coefficients[i] * power;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    SetCyclesPerIteration(state, start);
+}
+
+/********************************************************************************
+ * @brief Measures a single prediction of a piecewise-linear model with eight
+ *        segments and specified scalar type.
+ ********************************************************************************/
+template <typename T>
+void BM_PiecewisePredict(benchmark::State& state) {
+    PiecewiseLinReg<8, T> model{};
+    model.SetRange(T{0.0}, T{5.0});
+    for (std::size_t i{}; i < model.NumSegments(); ++i) {
+        model.GetSegment(i).SetParameters(T{1.0 + i}, T{-0.5 * i});
+    }
+    T input{1.5};
+    const auto start{READ_CYCLES()};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(input);
+        benchmark::DoNotOptimize(model.Predict(input));
+    }
+    SetCyclesPerIteration(state, start);
+}
+
+/********************************************************************************
+ * @brief Measures one training epoch of five training sets with specified 
+ *        scalar type.
+ ********************************************************************************/
+template <typename T>
+void BM_TrainEpoch(benchmark::State& state) {
+    container::Vector<T> inputs{}, outputs{};
+    CreateTrainingData(inputs, outputs);
+    LinReg<T> model{inputs, outputs};
+    const auto start{READ_CYCLES()};
+    for (auto _ : state) {
+        model.Train(1);
+        benchmark::ClobberMemory();
+    }
+    SetCyclesPerIteration(state, start);
+}
+
+/********************************************************************************
+ * @brief Measures predictions of specified number of values one at a time.
+ ********************************************************************************/
+void BM_PredictLoop(benchmark::State& state) {
+    const LinReg<double> model{100.0, -50.0};
+    container::Vector<double> inputs(static_cast<std::size_t>(state.range(0)));
+    container::Vector<double> outputs(inputs.Size());
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        inputs[i] = 0.001 * i;
+    }
+    for (auto _ : state) {
+        for (std::size_t i{}; i < inputs.Size(); ++i) {
+            outputs[i] = model.Predict(inputs[i]);
+            benchmark::DoNotOptimize(outputs[i]);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/********************************************************************************
+ * @brief Measures predictions of specified number of values with the 
+ *        vectorized batch kernel.
+ ********************************************************************************/
+void BM_PredictBatch(benchmark::State& state) {
+    const LinReg<double> model{100.0, -50.0};
+    container::Vector<double> inputs(static_cast<std::size_t>(state.range(0)));
+    container::Vector<double> outputs(inputs.Size());
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        inputs[i] = 0.001 * i;
+    }
+    for (auto _ : state) {
+        model.PredictBatch(inputs.Data(), outputs.Data(), inputs.Size());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/********************************************************************************
+ * @brief Measures one training epoch of specified number of training sets 
+ *        with specified training mode and order.
+ ********************************************************************************/
+void BM_TrainLarge(benchmark::State& state, const TrainMode mode, 
+                   const TrainOrder order = TrainOrder::kShuffled) {
+    container::Vector<double> inputs(static_cast<std::size_t>(state.range(0)));
+    container::Vector<double> outputs(inputs.Size());
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        inputs[i] = 0.001 * (i % 5000);
+        outputs[i] = 100.0 * inputs[i] - 50.0;
+    }
+    LinReg<double> model{inputs, outputs};
+    model.SetTrainOrder(order);
+    for (auto _ : state) {
+        model.Train(1, 0.01, mode, 256);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/********************************************************************************
+ * @brief Trains with referenced optimizer, learning rate (0 = automatic) and
+ *        training mode, optionally on standardized training data, until the 
+ *        parameters change less than 1e-6 during five consecutive epochs. The
+ *        test datasets y = 2x + 2, y = 3x - 5 and y = 100x - 50 are selected
+ *        by state.range(0). The number of epochs required is reported as the
+ *        "epochs" counter.
+ ********************************************************************************/
+template <template <typename> class Optimizer>
+void BM_EpochsToTolerance(benchmark::State& state, const Optimizer<double>& optimizer, 
+                          const double learning_rate, const TrainMode mode,
+                          const bool standardize = false) {
+    static constexpr double kWeights[]{2.0, 3.0, 100.0}, kBiases[]{2.0, -5.0, -50.0};
+    container::Vector<double> inputs{}, outputs{};
+    for (std::size_t i{}; i < 5; ++i) {
+        inputs.PushBack(i);
+        outputs.PushBack(kWeights[state.range(0)] * i + kBiases[state.range(0)]);
+    }
+    std::size_t num_epochs{};
+    for (auto _ : state) {
+        LinReg<double, Optimizer> model{inputs, outputs, standardize};
+        model.SetOptimizer(optimizer);
+        num_epochs = model.Train(100000, learning_rate, mode, 32, 1e-6, 5);
+        benchmark::DoNotOptimize(model.Weight());
+    }
+    state.counters["epochs"] = static_cast<double>(num_epochs);
+}
+
+/********************************************************************************
+ * @brief Measures one stochastic training epoch of a multivariate model on 
+ *        65536 training sets. The number of features is N, or state.range(0)
+ *        if specified at runtime (N = 0).
+ ********************************************************************************/
+template <std::size_t N>
+void BM_MultiTrainEpoch(benchmark::State& state) {
+    const std::size_t num_features{N > 0 ? N : static_cast<std::size_t>(state.range(0))};
+    const std::size_t num_sets{1 << 16};
+    container::Vector<double> inputs(num_sets * num_features), outputs(num_sets);
+    for (std::size_t i{}; i < num_sets; ++i) {
+        outputs[i] = 1.0;
+        for (std::size_t j{}; j < num_features; ++j) {
+            inputs[i * num_features + j] = 0.001 * ((i + j) % 1000);
+            outputs[i] += (j + 1.0) * inputs[i * num_features + j];
+        }
+    }
+    MultiLinReg<N> model{num_features};
+    model.LoadTrainingData(inputs, outputs);
+    for (auto _ : state) {
+        model.Train(1, 0.0);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * num_sets);
+}
+
+/********************************************************************************
+ * @brief Builds a list of state.range(0) values with specified allocator
+ *        policy, sums the values by traversing the list and clears it. Note
+ *        that glibc returns the released pool chunks to the OS (see
+ *        MALLOC_TRIM_THRESHOLD_), so each pool iteration includes page faults.
+ ********************************************************************************/
+template <template <typename> class Allocator>
+void BM_ListBuild(benchmark::State& state) {
+    const auto num_values{static_cast<int>(state.range(0))};
+    container::List<int, Allocator> list{};
+    for (auto _ : state) {
+        for (int i{}; i < num_values; ++i) {
+            list.PushBack(i);
+        }
+        long sum{};
+        for (const auto& value : list) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+        list.Clear();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/********************************************************************************
+ * @brief Returns the real time in seconds of one full-batch epoch of referenced
+ *        model trained by referenced trainer, averaged over num_epochs epochs.
+ ********************************************************************************/
+double EpochTime(ParallelTrainer& trainer, LinReg<double>& model, const std::size_t num_epochs) {
+    const auto start{std::chrono::steady_clock::now()};
+    for (std::size_t i{}; i < num_epochs; ++i) {
+        trainer.Train(model, 1, 0.01);
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / num_epochs;
+}
+
+/********************************************************************************
+ * @brief Benchmarks one full-batch epoch on state.range(0) training sets with
+ *        state.range(1) threads. Real time is measured, since the CPU time of
+ *        the calling thread excludes the work done by the other threads. The
+ *        time of a single-threaded epoch divided by the measured time is 
+ *        reported as the "speedup" counter.
+ ********************************************************************************/
+void BM_ParallelTrain(benchmark::State& state) {
+    container::Vector<double> inputs(static_cast<std::size_t>(state.range(0)));
+    container::Vector<double> outputs(inputs.Size());
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        inputs[i] = 0.001 * (i % 5000);
+        outputs[i] = 100.0 * inputs[i] - 50.0;
+    }
+    LinReg<double> model{inputs, outputs};
+    ParallelTrainer sequential{1};
+    const auto sequential_time{EpochTime(sequential, model, 3)};
+    ParallelTrainer trainer{static_cast<std::size_t>(state.range(1))};
+    const auto start{std::chrono::steady_clock::now()};
+    for (auto _ : state) {
+        trainer.Train(model, 1, 0.01);
+        benchmark::ClobberMemory();
+    }
+    const auto parallel_time{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() /
+                             state.iterations()};
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["speedup"] = sequential_time / parallel_time;
+}
+
+/********************************************************************************
+ * @brief Pushes state.range(0) values to a container::Vector, optionally with
+ *        the memory reserved in advance. The number of reallocations, i.e.
+ *        capacity changes, is reported as the "allocations" counter.
+ ********************************************************************************/
+void BM_PushBack(benchmark::State& state, const bool reserve) {
+    const auto num_values{static_cast<std::size_t>(state.range(0))};
+    std::size_t allocations{};
+    for (auto _ : state) {
+        container::Vector<double> values{};
+        allocations = 0;
+        if (reserve && values.Reserve(num_values)) ++allocations;
+        for (std::size_t i{}; i < num_values; ++i) {
+            const auto capacity{values.Capacity()};
+            values.PushBack(0.001 * i);
+            if (values.Capacity() != capacity) ++allocations;
+        }
+        benchmark::DoNotOptimize(values.Data());
+    }
+    state.counters["allocations"] = static_cast<double>(allocations);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/********************************************************************************
+ * @brief Pushes state.range(0) values to a container::Vector by growing it one
+ *        element at a time, i.e. with one reallocation per value, as the
+ *        container::Vector did before the capacity was introduced.
+ ********************************************************************************/
+void BM_PushBackResize(benchmark::State& state) {
+    const auto num_values{static_cast<std::size_t>(state.range(0))};
+    std::size_t allocations{};
+    for (auto _ : state) {
+        container::Vector<double> values{};
+        allocations = 0;
+        for (std::size_t i{}; i < num_values; ++i) {
+            if (values.Resize(i + 1)) ++allocations;
+            values[i] = 0.001 * i;
+        }
+        benchmark::DoNotOptimize(values.Data());
+    }
+    state.counters["allocations"] = static_cast<double>(allocations);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} /* namespace */
+
+BENCHMARK_TEMPLATE(BM_Predict, double);
+BENCHMARK_TEMPLATE(BM_Predict, fixed::Q16_16);
+BENCHMARK_TEMPLATE(BM_Predict, fixed::Q8_24);
+BENCHMARK_TEMPLATE(BM_PolyPredict, double);
+BENCHMARK_TEMPLATE(BM_PolyPredict, fixed::Q16_16);
+BENCHMARK_TEMPLATE(BM_PolyPredictPowers, double);
+BENCHMARK_TEMPLATE(BM_PolyPredictPowers, fixed::Q16_16);
+BENCHMARK_TEMPLATE(BM_PiecewisePredict, double);
+BENCHMARK_TEMPLATE(BM_PiecewisePredict, fixed::Q16_16);
+BENCHMARK_TEMPLATE(BM_TrainEpoch, double);
+BENCHMARK_TEMPLATE(BM_TrainEpoch, fixed::Q16_16);
+BENCHMARK_TEMPLATE(BM_TrainEpoch, fixed::Q8_24);
+BENCHMARK(BM_PredictLoop)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_PredictBatch)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK_CAPTURE(BM_TrainLarge, Stochastic, TrainMode::kStochastic)->Arg(1 << 20);
+BENCHMARK_CAPTURE(BM_TrainLarge, StochasticAffine, TrainMode::kStochastic, TrainOrder::kAffine)->Arg(1 << 20);
+BENCHMARK_CAPTURE(BM_TrainLarge, MiniBatch, TrainMode::kMiniBatch)->Arg(1 << 20);
+BENCHMARK_CAPTURE(BM_TrainLarge, Batch, TrainMode::kBatch)->Arg(1 << 20);
+BENCHMARK_CAPTURE(BM_EpochsToTolerance, SgdBatch, optimizer::Sgd<double>{}, 0.05, TrainMode::kBatch)->DenseRange(0, 2);
+BENCHMARK_CAPTURE(BM_EpochsToTolerance, MomentumBatch, optimizer::Momentum<double>{}, 0.05, TrainMode::kBatch)->DenseRange(0, 2);
+BENCHMARK_CAPTURE(BM_EpochsToTolerance, NesterovBatch, optimizer::Nesterov<double>{}, 0.05, TrainMode::kBatch)->DenseRange(0, 2);
+BENCHMARK_CAPTURE(BM_EpochsToTolerance, AdaGradBatch, optimizer::AdaGrad<double>{}, 30.0, TrainMode::kBatch)->DenseRange(0, 2);
+BENCHMARK_CAPTURE(BM_EpochsToTolerance, AdamBatch, optimizer::Adam<double>{}, 5.0, TrainMode::kBatch)->DenseRange(0, 2);
+BENCHMARK_CAPTURE(BM_EpochsToTolerance, SgdAutoBatch, optimizer::Sgd<double>{}, 0.0, TrainMode::kBatch)->DenseRange(0, 2);
+BENCHMARK_CAPTURE(BM_EpochsToTolerance, SgdAutoStandardizedBatch, optimizer::Sgd<double>{}, 0.0, TrainMode::kBatch, true)->DenseRange(0, 2);
+BENCHMARK_CAPTURE(BM_EpochsToTolerance, SgdStochastic, optimizer::Sgd<double>{}, 0.05, TrainMode::kStochastic)->DenseRange(0, 2);
+BENCHMARK_CAPTURE(BM_EpochsToTolerance, SgdAutoStochastic, optimizer::Sgd<double>{}, 0.0, TrainMode::kStochastic)->DenseRange(0, 2);
+BENCHMARK_CAPTURE(BM_EpochsToTolerance, SgdAutoStandardizedStochastic, optimizer::Sgd<double>{}, 0.0, TrainMode::kStochastic, true)->DenseRange(0, 2);
+BENCHMARK_CAPTURE(BM_EpochsToTolerance, NesterovStochastic, optimizer::Nesterov<double>{}, 0.05, TrainMode::kStochastic)->DenseRange(0, 2);
+BENCHMARK_CAPTURE(BM_EpochsToTolerance, AdamStochastic, optimizer::Adam<double>{}, 5.0, TrainMode::kStochastic)->DenseRange(0, 2);
+BENCHMARK_TEMPLATE(BM_MultiTrainEpoch, 3);
+BENCHMARK_TEMPLATE(BM_MultiTrainEpoch, 16);
+BENCHMARK_TEMPLATE(BM_MultiTrainEpoch, 0)->Arg(3)->Arg(16);
+BENCHMARK_CAPTURE(BM_PushBack, Grow, false)->Arg(1 << 20);
+BENCHMARK_CAPTURE(BM_PushBack, Reserved, true)->Arg(1 << 20);
+BENCHMARK(BM_PushBackResize)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_ListBuild, container::PoolAllocator)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_ListBuild, container::HeapAllocator)->Arg(1 << 16);
+BENCHMARK(BM_ParallelTrain)->ArgsProduct({{1 << 22}, {1, 2, 4, 8, 16, 32}})->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,397 @@
+/********************************************************************************
+ * @brief Implementation details for the LinReg class.
+ ********************************************************************************/
+#pragma once
+
+#include "lin_reg.hpp"
+
+namespace yrgo {
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The specified training data is copied element by element into the
+ *           buffers, so any container with Size and an index operator is accepted.
+ *        2. If the number of input and reference values don't match, the
+ *           superfluous values of the larger container are ignored.
+ *        3. The train order buffer is not initialized until it's needed, 
+ *           i.e. when training in stochastic mode with shuffled order.
+ *        4. If standardization is enabled, the means and deviation sums of the
+ *           values are accumulated during the copy (Welford's method). The
+ *           stored values are then standardized in place, which requires a
+ *           second pass, since every value depends on the mean and standard
+ *           deviation of all values.
+ *        5. The state of the optimizer is reset, since it belongs to the 
+ *           previous training data.
+ *        6. The automatic learning rates are derived from the stored input values.
+ ********************************************************************************/
+template <typename T, template <typename> class Optimizer, template <typename> class Buffer>
+template <typename Container>
+bool LinReg<T, Optimizer, Buffer>::LoadTrainingData(const Container& train_in, 
+                                                    const Container& train_out,
+                                                    const bool standardize) {
+    const auto num_sets{train_in.Size() < train_out.Size() ? train_in.Size() : train_out.Size()};
+    if (!train_in_.Resize(num_sets) || !train_out_.Resize(num_sets)) {
+        train_in_.Clear();
+        train_out_.Clear();
+        return false;
+    }
+    double input_mean{}, output_mean{}, input_sq{}, output_sq{};
+    for (size_t i{}; i < num_sets; ++i) {
+        train_in_[i] = train_in[i];
+        train_out_[i] = train_out[i];
+        if (standardize) {
+            Accumulate(static_cast<double>(train_in_[i]), i + 1, input_mean, input_sq);
+            Accumulate(static_cast<double>(train_out_[i]), i + 1, output_mean, output_sq);
+        }
+    }
+    standardized_ = standardize;
+    if (standardized_) Standardize(input_mean, output_mean, input_sq, output_sq);
+    optimizer_.Reset();
+    InitAutoLearningRates();
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The buffers are moved into the model, after which the larger one
+ *           is shrunk to the size of the smaller one. Shrinking never allocates.
+ *        2. If standardization is enabled, the means and deviation sums are
+ *           accumulated in a single pass over the stored values, after which
+ *           the values are standardized in place.
+ *        3. As when copying the training data, the optimizer is reset and the
+ *           automatic learning rates are derived from the stored input values.
+ ********************************************************************************/
+template <typename T, template <typename> class Optimizer, template <typename> class Buffer>
+void LinReg<T, Optimizer, Buffer>::LoadTrainingData(Buffer<T>&& train_in, Buffer<T>&& train_out,
+                                                    const bool standardize) {
+    train_in_ = static_cast<Buffer<T>&&>(train_in);
+    train_out_ = static_cast<Buffer<T>&&>(train_out);
+    const auto num_sets{train_in_.Size() < train_out_.Size() ? train_in_.Size() : train_out_.Size()};
+    train_in_.Resize(num_sets);
+    train_out_.Resize(num_sets);
+    double input_mean{}, output_mean{}, input_sq{}, output_sq{};
+    if (standardize) {
+        for (size_t i{}; i < num_sets; ++i) {
+            Accumulate(static_cast<double>(train_in_[i]), i + 1, input_mean, input_sq);
+            Accumulate(static_cast<double>(train_out_[i]), i + 1, output_mean, output_sq);
+        }
+    }
+    standardized_ = standardize;
+    if (standardized_) Standardize(input_mean, output_mean, input_sq, output_sq);
+    optimizer_.Reset();
+    InitAutoLearningRates();
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. If the training data is standardized, the parameters are converted
+ *           to standardized units before the training and back to the original 
+ *           units afterwards. Hence Predict is still a single multiply-add.
+ ********************************************************************************/
+template <typename T, template <typename> class Optimizer, template <typename> class Buffer>
+size_t LinReg<T, Optimizer, Buffer>::Train(const size_t num_epochs, const T learning_rate, 
+                                           const TrainMode mode, const size_t batch_size,
+                                           const T tolerance, const size_t patience) {
+    if (standardized_) ToStandardized();
+    const auto epochs{TrainEpochs(num_epochs, learning_rate, mode, batch_size, tolerance, patience)};
+    if (standardized_) FromStandardized();
+    return epochs;
+}
+
+/********************************************************************************
+ * @note Implementation details:
+ *        1. A loop is generated to run num_epochs number of times. The learning
+ *           rate of each epoch is calculated from the base learning rate (or 
+ *           the automatic learning rate if 0 is specified) by the schedule.
+ *        2. In stochastic mode, we train the model with all the training sets
+ *           one by one in a new random order each epoch.
+ *        3. In batch and mini-batch mode, the training sets are split into
+ *           contiguous batches (one batch in batch mode), which are read in 
+ *           stored order. The model is optimized once per batch.
+ *        4. Each epoch returns the change of the weight and bias to the shared
+ *           training loop, which stops the training once the change has been
+ *           within the tolerance for patience consecutive epochs. Only the
+ *           parameters before the epoch are stored, so no extra pass through
+ *           the training sets is required.
+ ********************************************************************************/
+template <typename T, template <typename> class Optimizer, template <typename> class Buffer>
+size_t LinReg<T, Optimizer, Buffer>::TrainEpochs(const size_t num_epochs, const T learning_rate, 
+                                                 const TrainMode mode, const size_t batch_size,
+                                                 const T tolerance, const size_t patience) {
+    const auto num_sets{train_in_.Size()};
+    const auto step{mode == TrainMode::kMiniBatch && batch_size > 0 ? batch_size : num_sets};
+    const auto base_rate{learning_rate != T{} ? learning_rate : AutoLearningRate(mode)};
+    return detail::TrainEpochs(num_epochs, tolerance, patience, [&](const size_t epoch) {
+        const auto weight{weight_}, bias{bias_};
+        const auto rate{schedule_.GetType() == Schedule::Type::kConstant ? base_rate : 
+                        static_cast<T>(schedule_.Rate(static_cast<double>(base_rate), epoch))};
+        if (mode == TrainMode::kStochastic) {
+            OptimizeStochastic(rate);
+        } else {
+            for (size_t begin{}; begin < num_sets; begin += step) {
+                OptimizeBatch(begin, num_sets - begin < step ? num_sets - begin : step, rate);
+            }
+        }
+        return detail::Distance(weight_, weight) + detail::Distance(bias_, bias);
+    });
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Each training set is observed by an online model, which updates
+ *           the means and deviation sums of the training data via Welford's
+ *           method in a single pass.
+ *        2. If the online model is fitted, the least-squares weight and bias
+ *           are copied (and converted to the original units if the training
+ *           data is standardized). Else all input values are equal (or fewer
+ *           than two training sets are stored) and the weight cannot be determined.
+ ********************************************************************************/
+template <typename T, template <typename> class Optimizer, template <typename> class Buffer>
+bool LinReg<T, Optimizer, Buffer>::Fit(void) {
+    OnlineLinReg stats{};
+    for (size_t i{}; i < train_in_.Size(); ++i) {
+        stats.Observe(static_cast<double>(train_in_[i]), static_cast<double>(train_out_[i]));
+    }
+    if (!stats.Fitted()) return false;
+    weight_ = static_cast<T>(stats.Weight());
+    bias_ = static_cast<T>(stats.Bias());
+    if (standardized_) FromStandardized();
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The header is written, where the scalar size and fractional bits
+ *           prevent a model saved with another scalar type from being loaded.
+ *        2. The raw bytes of the weight and bias are copied, so no conversion
+ *           is performed and fixed-point models are restored exactly.
+ *        3. The CRC-16 of the header and parameters is appended.
+ ********************************************************************************/
+template <typename T, template <typename> class Optimizer, template <typename> class Buffer>
+bool LinReg<T, Optimizer, Buffer>::Save(uint8_t* data, const size_t size) const {
+    if (size < kSerializedSize) return false;
+    data[0] = kMagic[0];
+    data[1] = kMagic[1];
+    data[2] = kVersion;
+    data[3] = sizeof(T);
+    data[4] = fixed::FracBits<T>::value;
+    memcpy(data + kHeaderSize, &weight_, sizeof(T));
+    memcpy(data + kHeaderSize + sizeof(T), &bias_, sizeof(T));
+    const auto crc{crc::Crc16(data, kSerializedSize - 2)};
+    data[kSerializedSize - 2] = static_cast<uint8_t>(crc);
+    data[kSerializedSize - 1] = static_cast<uint8_t>(crc >> 8);
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The header is compared against the header this model would save.
+ *        2. The CRC-16 is verified before any parameter is copied, so a
+ *           rejected buffer leaves the model unchanged.
+ *        3. The parameters are set via SetParameters, which resets the optimizer.
+ ********************************************************************************/
+template <typename T, template <typename> class Optimizer, template <typename> class Buffer>
+bool LinReg<T, Optimizer, Buffer>::Load(const uint8_t* data, const size_t size) {
+    if (size < kSerializedSize) return false;
+    if (data[0] != kMagic[0] || data[1] != kMagic[1] || data[2] != kVersion ||
+        data[3] != sizeof(T) || data[4] != fixed::FracBits<T>::value) return false;
+    const auto crc{crc::Crc16(data, kSerializedSize - 2)};
+    if (data[kSerializedSize - 2] != static_cast<uint8_t>(crc) ||
+        data[kSerializedSize - 1] != static_cast<uint8_t>(crc >> 8)) return false;
+    T weight{}, bias{};
+    memcpy(&weight, data + kHeaderSize, sizeof(T));
+    memcpy(&bias, data + kHeaderSize + sizeof(T), sizeof(T));
+    SetParameters(weight, bias);
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. If the number of training sets has changed, the train order
+ *           container::Vector is initialized.
+ *        2. The training order container::Vector is shuffled with the Fisher-Yates
+ *           algorithm, i.e. starting from the last index i, the element is swapped
+ *           with a random element among index 0 - i, which are not yet placed.
+ *        3. The random indexes are generated by the model's own generator, hence
+ *           no global state is shared between models and the order is
+ *           reproducible via Seed.
+ ********************************************************************************/
+template <typename T, template <typename> class Optimizer, template <typename> class Buffer>
+void LinReg<T, Optimizer, Buffer>::RandomizeTrainingOrder(void) {
+    if (train_order_.Size() != train_in_.Size()) InitTrainOrderVector();
+    random::Shuffle(train_order_.Data(), train_order_.Size(), rng_);
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. In shuffled order, the training order is randomized and we fetch
+ *           the index of each training set from the train order buffer.
+ *        2. In affine order, a new random affine permutation is created, which
+ *           generates the index of each training set on the fly. Creating the
+ *           permutation only requires a few random numbers, regardless of the
+ *           number of training sets.
+ ********************************************************************************/
+template <typename T, template <typename> class Optimizer, template <typename> class Buffer>
+void LinReg<T, Optimizer, Buffer>::OptimizeStochastic(const T learning_rate) {
+    if (order_ == TrainOrder::kShuffled) {
+        RandomizeTrainingOrder();
+        for (auto& j : train_order_) { 
+            Optimize(train_in_[j], train_out_[j], learning_rate);
+        }
+    } else {
+        random::AffinePermutation order{train_in_.Size(), rng_};
+        for (size_t i{}; i < train_in_.Size(); ++i) {
+            const auto j{order.Next()};
+            Optimize(train_in_[j], train_out_[j], learning_rate);
+        }
+    }
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. If input != 0, we predict with the input and let the optimizer adjust
+ *           the parameters according to the error, i.e. the descents are 
+ *           error * x for the weight and error for the bias.
+ *        2. Else, we set the bias to the y_ref value, since y = m if x = 0.
+ *           (y = kx + m = k * 0 + 0 => y = m when k = 0).
+ ********************************************************************************/
+template <typename T, template <typename> class Optimizer, template <typename> class Buffer>
+void LinReg<T, Optimizer, Buffer>::Optimize(const T input, const T reference, const T learning_rate) {
+    if (input != T{}) {
+        const auto error{reference - Predict(input)}; /* error = y_ref - y_pred */
+        optimizer_.Update(weight_, bias_, error * input, error, learning_rate);
+    } else {
+        bias_ = reference;                            /* m = y_ref when x = 0 */
+    }
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The sums of the errors and the errors multiplied by the inputs are
+ *           calculated over the batch with a vectorized reduction.
+ *        2. The parameters are adjusted by the optimizer with the average 
+ *           descents of the batch, i.e. the sums are divided by the batch size:
+ *           sum(error * x) / n for the weight and sum(error) / n for the bias.
+ ********************************************************************************/
+template <typename T, template <typename> class Optimizer, template <typename> class Buffer>
+void LinReg<T, Optimizer, Buffer>::OptimizeBatch(const size_t begin, const size_t size, const T learning_rate) {
+    T error_sum{}, error_input_sum{};
+    simd::ErrorSums(train_in_.Data() + begin, train_out_.Data() + begin, size, 
+                    weight_, bias_, error_sum, error_input_sum);
+    const auto num_sets{static_cast<T>(static_cast<double>(size))};
+    optimizer_.Update(weight_, bias_, error_input_sum / num_sets, 
+                      error_sum / num_sets, learning_rate);
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The standard deviations are calculated from the deviation sums and
+ *           used as scales. A scale of 0 (all values equal) is replaced by 1,
+ *           so that the values are only centered.
+ *        2. Each stored value is standardized as v' = (v - mean) / scale.
+ ********************************************************************************/
+template <typename T, template <typename> class Optimizer, template <typename> class Buffer>
+void LinReg<T, Optimizer, Buffer>::Standardize(const double input_mean, const double output_mean,
+                                               const double input_sq, const double output_sq) {
+    const auto num_sets{train_in_.Size() > 0 ? static_cast<double>(train_in_.Size()) : 1.0};
+    input_mean_ = static_cast<T>(input_mean);
+    output_mean_ = static_cast<T>(output_mean);
+    input_scale_ = static_cast<T>(input_sq > 0 ? sqrt(input_sq / num_sets) : 1.0);
+    output_scale_ = static_cast<T>(output_sq > 0 ? sqrt(output_sq / num_sets) : 1.0);
+    for (size_t i{}; i < train_in_.Size(); ++i) {
+        train_in_[i] = (train_in_[i] - input_mean_) / input_scale_;
+        train_out_[i] = (train_out_[i] - output_mean_) / output_scale_;
+    }
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. With standardized values, y' = k'x' + m' corresponds to 
+ *           y = k'(sy / sx)(x - mx) + sy * m' + my. Hence k' = k * sx / sy and
+ *           m' = (k * mx + m - my) / sy.
+ *        2. Both parameters are calculated before any is assigned, so the 
+ *           references may refer to the parameters of the model itself.
+ ********************************************************************************/
+template <typename T, template <typename> class Optimizer, template <typename> class Buffer>
+void LinReg<T, Optimizer, Buffer>::StandardizedParameters(T& weight, T& bias) const {
+    if (!standardized_) {
+        weight = weight_;
+        bias = bias_;
+        return;
+    }
+    const T standardized_weight{weight_ * input_scale_ / output_scale_};
+    const T standardized_bias{(weight_ * input_mean_ + bias_ - output_mean_) / output_scale_};
+    weight = standardized_weight;
+    bias = standardized_bias;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The parameters are set via SetParameters, which resets the 
+ *           optimizer, and converted back to the original units if needed.
+ ********************************************************************************/
+template <typename T, template <typename> class Optimizer, template <typename> class Buffer>
+void LinReg<T, Optimizer, Buffer>::SetStandardizedParameters(const T weight, const T bias) {
+    SetParameters(weight, bias);
+    if (standardized_) FromStandardized();
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The conversion is done by StandardizedParameters.
+ ********************************************************************************/
+template <typename T, template <typename> class Optimizer, template <typename> class Buffer>
+void LinReg<T, Optimizer, Buffer>::ToStandardized(void) {
+    StandardizedParameters(weight_, bias_);
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The inverse of ToStandardized, i.e. k = k' * sy / sx and
+ *           m = my + sy * m' - k * mx.
+ ********************************************************************************/
+template <typename T, template <typename> class Optimizer, template <typename> class Buffer>
+void LinReg<T, Optimizer, Buffer>::FromStandardized(void) {
+    weight_ = weight_ * output_scale_ / input_scale_;
+    bias_ = output_mean_ + bias_ * output_scale_ - weight_ * input_mean_;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The mean and maximum of the squared input values are calculated
+ *           with double precision in a single pass.
+ *        2. For an update with input x, the error of the weight and bias is
+ *           reduced by a factor of at most 1 - LR * (x^2 + 1). The learning
+ *           rate LR = 1 / (x^2 + 1) therefore never overshoots. The maximum
+ *           is used for single training sets, while the mean is used in batch
+ *           mode, since the average gradient of all sets is used.
+ ********************************************************************************/
+template <typename T, template <typename> class Optimizer, template <typename> class Buffer>
+void LinReg<T, Optimizer, Buffer>::InitAutoLearningRates(void) {
+    double square_sum{}, square_max{};
+    for (size_t i{}; i < train_in_.Size(); ++i) {
+        const auto input{static_cast<double>(train_in_[i])};
+        square_sum += input * input;
+        if (input * input > square_max) square_max = input * input;
+    }
+    const auto square_mean{train_in_.Size() > 0 ? square_sum / train_in_.Size() : 0.0};
+    stochastic_rate_ = static_cast<T>(1.0 / (square_max + 1.0));
+    batch_rate_ = static_cast<T>(1.0 / (square_mean + 1.0));
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The size of the train order buffer is set to the number of stored
+ *           training sets.
+ *        2. The container::Vector is assigned the index of each stored training set, e.g.
+ *           0 - 9 if ten training sets are stored.
+ ********************************************************************************/
+template <typename T, template <typename> class Optimizer, template <typename> class Buffer>
+void LinReg<T, Optimizer, Buffer>::InitTrainOrderVector(void) {
+    train_order_.Resize(train_in_.Size());
+    for (size_t i{}; i < train_order_.Size(); ++i) {
+        train_order_[i] = i;
+    }
+}
+
+} /* namespace yrgo */
\ No newline at end of file
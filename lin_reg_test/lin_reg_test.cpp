@@ -2,7 +2,21 @@
  * @brief Testing linear regression model implementation with Google Test.
  ********************************************************************************/
 #include <gtest/gtest.h>
+#include <limits>
 #include "lin_reg.hpp"
+#include "online_lin_reg.hpp"
+#include "fixed_point.hpp"
+#include "lookup_table.hpp"
+#include "random.hpp"
+#include "crc.hpp"
+#include "log_store.hpp"
+#include "parallel_trainer.hpp"
+#include "multi_lin_reg.hpp"
+#include "poly_reg.hpp"
+#include "piecewise_lin_reg.hpp"
+#include "small_vector.hpp"
+#include "static_vector.hpp"
+#include "list.hpp"
 
 using namespace yrgo;
 
@@ -48,6 +62,1364 @@ TEST(LinRegTest, Test3) {
     }
 }
 
+/********************************************************************************
+ * @brief Tests model fitted to predict y = 100x - 50 with the closed-form 
+ *        least-squares solution.
+ ********************************************************************************/
+TEST(LinRegTest, Fit) { 
+    const container::Vector<double> inputs{{0, 1, 2, 3, 4}};
+    const container::Vector<double> outputs{{-50, 50, 150, 250, 350}};
+    yrgo::LinReg model{inputs, outputs}; 
+    EXPECT_TRUE(model.Fit()); 
+    EXPECT_NEAR(100.0, model.Weight(), 0.001);
+    EXPECT_NEAR(-50.0, model.Bias(), 0.001);
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        EXPECT_NEAR(outputs[i], model.Predict(inputs[i]), 0.001); 
+    }
+}
+
+/********************************************************************************
+ * @brief Tests that the closed-form solution matches the parameters obtained
+ *        when training during 1000 epochs with a learning rate of 1 %.
+ ********************************************************************************/
+TEST(LinRegTest, FitMatchesTrain) { 
+    const container::Vector<double> inputs{{0, 1, 2, 3, 4}};
+    const container::Vector<double> outputs{{-5, -2, 1, 4, 7}};
+    yrgo::LinReg trained{inputs, outputs}, fitted{inputs, outputs}; 
+    trained.Train(1000); 
+    EXPECT_TRUE(fitted.Fit());
+    EXPECT_NEAR(trained.Weight(), fitted.Weight(), 0.001);
+    EXPECT_NEAR(trained.Bias(), fitted.Bias(), 0.001);
+}
+
+/********************************************************************************
+ * @brief Tests that fitting fails if all input values are equal.
+ ********************************************************************************/
+TEST(LinRegTest, FitDegenerate) { 
+    const container::Vector<double> inputs{{2, 2, 2}};
+    const container::Vector<double> outputs{{1, 2, 3}};
+    yrgo::LinReg model{inputs, outputs}; 
+    EXPECT_FALSE(model.Fit()); 
+}
+
+/********************************************************************************
+ * @brief Tests online model observing the samples of y = 2.5x - 10 one at a
+ *        time, which shall match the closed-form solution of the stored data.
+ ********************************************************************************/
+TEST(OnlineLinRegTest, Observe) { 
+    const container::Vector<double> inputs{{0, 1, 2, 3, 4}};
+    const container::Vector<double> outputs{{-10, -7.5, -5, -2.5, 0}};
+    yrgo::OnlineLinReg model{};
+    EXPECT_FALSE(model.Fitted());
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        model.Observe(inputs[i], outputs[i]);
+    }
+    EXPECT_EQ(inputs.Size(), model.Count());
+    EXPECT_TRUE(model.Fitted());
+    EXPECT_NEAR(2.5, model.Weight(), 0.001);
+    EXPECT_NEAR(-10.0, model.Bias(), 0.001);
+    EXPECT_NEAR(5.0, model.Predict(6), 0.001);
+
+    yrgo::LinReg fitted{inputs, outputs};
+    EXPECT_TRUE(fitted.Fit());
+    EXPECT_DOUBLE_EQ(fitted.Weight(), model.Weight());
+    EXPECT_DOUBLE_EQ(fitted.Bias(), model.Bias());
+}
+
+/********************************************************************************
+ * @brief Tests that the online model predicts the mean of the observed 
+ *        reference values until at least two different inputs are observed.
+ ********************************************************************************/
+TEST(OnlineLinRegTest, Reset) { 
+    yrgo::OnlineLinReg model{};
+    model.Observe(1, 4);
+    model.Observe(1, 6);
+    EXPECT_FALSE(model.Fitted());
+    EXPECT_DOUBLE_EQ(5.0, model.Predict(3));
+    model.Reset();
+    EXPECT_EQ(0U, model.Count());
+    EXPECT_DOUBLE_EQ(0.0, model.Predict(3));
+}
+
+/********************************************************************************
+ * @brief Tests that the sample count doesn't wrap after 65 536 samples, which
+ *        would cause division by zero on AVR if size_t were used.
+ ********************************************************************************/
+TEST(OnlineLinRegTest, ManySamples) { 
+    yrgo::OnlineLinReg first{}, second{};
+    for (std::uint32_t i{}; i < 70000; ++i) {
+        const double x{static_cast<double>(i % 100)};
+        first.Observe(x, 0.5 * x + 3.0);
+        second.Observe(x, 0.5 * x + 3.0);
+    }
+    EXPECT_EQ(70000U, first.Count());
+    EXPECT_NEAR(0.5, first.Weight(), 1e-9);
+    EXPECT_NEAR(3.0, first.Bias(), 1e-9);
+    first.Merge(second);
+    EXPECT_EQ(140000U, first.Count());
+    EXPECT_NEAR(0.5, first.Weight(), 1e-9);
+    EXPECT_NEAR(3.0, first.Bias(), 1e-9);
+}
+
+/********************************************************************************
+ * @brief Tests model fitted to predict y = 100x - 50 at compile time, which shall
+ *        yield the same parameters as fitting and training at runtime.
+ ********************************************************************************/
+TEST(LinRegTest, TrainAtCompileTime) { 
+    static constexpr double kInputs[]{0, 1, 2, 3, 4};
+    static constexpr double kOutputs[]{-50, 50, 150, 250, 350};
+    static constexpr auto kModel{yrgo::TrainAtCompileTime(kInputs, kOutputs)};
+    static constexpr double kWeight{kModel.Weight()};
+    static constexpr double kBias{kModel.Bias()};
+    static_assert(kModel.Fitted(), "Model not fitted at compile time!");
+    static_assert(kWeight > 99.999 && kWeight < 100.001, "Invalid weight!");
+    static_assert(kBias > -50.001 && kBias < -49.999, "Invalid bias!");
+
+    const container::Vector<double> inputs{kInputs};
+    const container::Vector<double> outputs{kOutputs};
+    yrgo::LinReg fitted{inputs, outputs}, trained{inputs, outputs}; 
+    EXPECT_TRUE(fitted.Fit());
+    EXPECT_DOUBLE_EQ(fitted.Weight(), kWeight);
+    EXPECT_DOUBLE_EQ(fitted.Bias(), kBias);
+    trained.Train(1000);
+    EXPECT_NEAR(trained.Weight(), kWeight, 0.001);
+    EXPECT_NEAR(trained.Bias(), kBias, 0.001);
+
+    const yrgo::LinReg model{kWeight, kBias};
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        EXPECT_NEAR(outputs[i], model.Predict(inputs[i]), 0.001); 
+    }
+}
+
+/********************************************************************************
+ * @brief Trains a model of specified scalar type during 1000 epochs with a
+ *        learning rate of 1 % and returns the maximum deviation from the
+ *        predictions of a model trained with double precision.
+ ********************************************************************************/
+template <typename T, std::size_t size>
+double MaxDeviationFromDouble(const double (&in)[size], const double (&out)[size]) {
+    const container::Vector<double> inputs{in}, outputs{out};
+    container::Vector<T> fixed_inputs{}, fixed_outputs{};
+    for (std::size_t i{}; i < size; ++i) {
+        fixed_inputs.PushBack(T{in[i]});
+        fixed_outputs.PushBack(T{out[i]});
+    }
+    yrgo::LinReg<double> reference{inputs, outputs};
+    yrgo::LinReg<T> model{fixed_inputs, fixed_outputs};
+    reference.Train(1000);
+    model.Train(1000);
+
+    double max_deviation{};
+    for (std::size_t i{}; i < size; ++i) {
+        const auto deviation{static_cast<double>(model.Predict(fixed_inputs[i])) - 
+                             reference.Predict(inputs[i])};
+        if (deviation > max_deviation) max_deviation = deviation;
+        if (-deviation > max_deviation) max_deviation = -deviation;
+    }
+    return max_deviation;
+}
+
+/********************************************************************************
+ * @brief Tests saturating fixed-point arithmetic.
+ ********************************************************************************/
+TEST(FixedPointTest, Arithmetic) { 
+    using fixed::Q16_16;
+    EXPECT_DOUBLE_EQ(3.75, static_cast<double>(Q16_16{1.5} * Q16_16{2.5}));
+    EXPECT_DOUBLE_EQ(-0.5, static_cast<double>(Q16_16{1.5} / Q16_16{-3.0}));
+    EXPECT_DOUBLE_EQ(7.0, static_cast<double>(fixed::MulAdd(Q16_16{2.0}, Q16_16{3.0}, Q16_16{1.0})));
+    EXPECT_EQ(Q16_16::kRawMax, (Q16_16{30000.0} + Q16_16{30000.0}).Raw());
+    EXPECT_EQ(Q16_16::kRawMin, (Q16_16{-300.0} * Q16_16{300.0}).Raw());
+    EXPECT_EQ(Q16_16::kRawMax, (Q16_16{1.0} / Q16_16{}).Raw());
+    EXPECT_EQ(fixed::Q8_24::kRawMax, fixed::Q8_24{1000.0}.Raw());
+    EXPECT_EQ(3, Q16_16{2.5}.Round());
+    EXPECT_EQ(-3, Q16_16{-2.6}.Round());
+    EXPECT_EQ(2, fixed::Truncate(Q16_16{2.9}));
+    EXPECT_EQ(-2, fixed::Truncate(Q16_16{-2.9}));
+    EXPECT_EQ(-2, fixed::Truncate(-2.9));
+}
+
+/********************************************************************************
+ * @brief Tests that converting floating-point numbers out of range saturates,
+ *        that NaN is converted to 0 and that the conversion is explicit.
+ ********************************************************************************/
+TEST(FixedPointTest, ConvertFromDouble) { 
+    using fixed::Q16_16;
+    static_assert(!std::is_convertible_v<double, Q16_16>, "Conversion must be explicit!");
+    EXPECT_EQ(Q16_16::kRawMax, Q16_16{32767.99999}.Raw());
+    EXPECT_EQ(Q16_16::kRawMax, Q16_16{1e30}.Raw());
+    EXPECT_EQ(Q16_16::kRawMin, Q16_16{-1e30}.Raw());
+    EXPECT_EQ(Q16_16::kRawMax, Q16_16{std::numeric_limits<double>::infinity()}.Raw());
+    EXPECT_EQ(Q16_16::kRawMin, Q16_16{-std::numeric_limits<double>::infinity()}.Raw());
+    EXPECT_EQ(0, Q16_16{std::numeric_limits<double>::quiet_NaN()}.Raw());
+    EXPECT_EQ(Q16_16::kRawMin, Q16_16{-32768.0}.Raw());
+    EXPECT_EQ(-Q16_16::kRawOne, Q16_16{-1.0}.Raw());
+}
+
+/********************************************************************************
+ * @brief Tests that models trained in Q16.16 and Q8.24 fixed point predict the
+ *        same values as models trained with double precision.
+ ********************************************************************************/
+TEST(FixedPointTest, LinRegAccuracy) { 
+    static constexpr double kInputs[]{0, 1, 2, 3, 4};
+    static constexpr double kOutputs1[]{2, 4, 6, 8, 10};
+    static constexpr double kOutputs2[]{-5, -2, 1, 4, 7};
+    static constexpr double kOutputs3[]{-50, 50, 150, 250, 350};
+    EXPECT_LT((MaxDeviationFromDouble<fixed::Q16_16>(kInputs, kOutputs1)), 0.002);
+    EXPECT_LT((MaxDeviationFromDouble<fixed::Q16_16>(kInputs, kOutputs2)), 0.002);
+    EXPECT_LT((MaxDeviationFromDouble<fixed::Q16_16>(kInputs, kOutputs3)), 0.002);
+    EXPECT_LT((MaxDeviationFromDouble<fixed::Q8_24>(kInputs, kOutputs1)), 0.00001);
+    EXPECT_LT((MaxDeviationFromDouble<fixed::Q8_24>(kInputs, kOutputs2)), 0.00001);
+}
+
+/********************************************************************************
+ * @brief Tests that the lookup table generated from a trained model predicts
+ *        the rounded temperature for every 10-bit ADC code.
+ ********************************************************************************/
+TEST(LookupTableTest, AdcCodes) { 
+    static constexpr double kInputScale{5.0 / 1023};
+    const container::Vector<double> inputs{{0, 1, 2, 3, 4}};
+    const container::Vector<double> outputs{{-50, 50, 150, 250, 350}};
+    yrgo::LinReg model{inputs, outputs};
+    EXPECT_TRUE(model.Fit());
+    yrgo::LookupTable<> table{};
+    table.Generate(model, kInputScale);
+
+    for (std::uint16_t code{}; code <= 1023; ++code) {
+        const auto prediction{model.Predict(code * kInputScale)};
+        EXPECT_LE(std::abs(table.Lookup(code) - prediction), 0.5 + 1.0 / 32);
+    }
+    EXPECT_EQ(-50, table.Lookup(0));
+    EXPECT_EQ(450, table.Lookup(1023));
+    EXPECT_EQ(450, table.Lookup(2000));
+}
+
+/********************************************************************************
+ * @brief Tests that a lookup table generated at compile time equals a table
+ *        generated from a model at runtime.
+ ********************************************************************************/
+TEST(LookupTableTest, CompileTime) { 
+    static constexpr yrgo::LookupTable<> kTable{2.5, -10.0, 0.01};
+    static_assert(kTable.Lookup(400) == 0, "Invalid lookup table!");
+    yrgo::LookupTable<> table{};
+    table.Generate(yrgo::LinReg<>{2.5, -10.0}, 0.01);
+    for (std::uint16_t code{}; code <= 1023; ++code) {
+        EXPECT_EQ(kTable.Lookup(code), table.Lookup(code));
+    }
+}
+
+/********************************************************************************
+ * @brief Tests that predictions outside the range of the table saturate at
+ *        the minimum and maximum values instead of wrapping around.
+ ********************************************************************************/
+TEST(LookupTableTest, Saturate) { 
+    static constexpr yrgo::LookupTable<> kRising{100.0, 0.0, 1.0};
+    static constexpr yrgo::LookupTable<> kFalling{-100.0, 0.0, 1.0};
+    EXPECT_EQ(0, kRising.Lookup(0));
+    EXPECT_EQ(0, kFalling.Lookup(0));
+    EXPECT_GE(kRising.Lookup(1023), 2047);
+    EXPECT_LE(kFalling.Lookup(1023), -2048);
+    for (std::uint16_t code{1}; code <= 1023; ++code) {
+        EXPECT_LE(kRising.Lookup(code - 1), kRising.Lookup(code));
+        EXPECT_GE(kFalling.Lookup(code - 1), kFalling.Lookup(code));
+    }
+}
+
+/********************************************************************************
+ * @brief Tests that batch predictions equal single predictions, both for the
+ *        vectorized double precision kernel and the scalar fixed-point kernel.
+ ********************************************************************************/
+TEST(LinRegTest, PredictBatch) { 
+    const yrgo::LinReg<double> model{2.5, -10.0};
+    container::Vector<double> inputs{}, outputs{};
+    for (std::size_t i{}; i < 37; ++i) {
+        inputs.PushBack(0.25 * i - 3.0);
+    }
+    EXPECT_TRUE(model.PredictBatch(inputs, outputs));
+    ASSERT_EQ(inputs.Size(), outputs.Size());
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        EXPECT_NEAR(model.Predict(inputs[i]), outputs[i], 1e-12);
+    }
+
+    const yrgo::LinReg<fixed::Q16_16> fixed_model{fixed::Q16_16{2.5}, fixed::Q16_16{-10.0}};
+    fixed::Q16_16 values[]{fixed::Q16_16{-1.0}, fixed::Q16_16{0.5}, fixed::Q16_16{3.25}};
+    fixed_model.PredictBatch(values, values, 3);
+    EXPECT_EQ(fixed_model.Predict(fixed::Q16_16{-1.0}), values[0]);
+    EXPECT_EQ(fixed_model.Predict(fixed::Q16_16{0.5}), values[1]);
+    EXPECT_EQ(fixed_model.Predict(fixed::Q16_16{3.25}), values[2]);
+}
+
+/********************************************************************************
+ * @brief Tests model trained to predict y = 100x - 50 during 1000 epochs with
+ *        full-batch gradient descent and a learning rate of 10 %.
+ ********************************************************************************/
+TEST(LinRegTest, TrainBatch) { 
+    const container::Vector<double> inputs{{0, 1, 2, 3, 4}};
+    const container::Vector<double> outputs{{-50, 50, 150, 250, 350}};
+    yrgo::LinReg model{inputs, outputs}; 
+    model.Train(1000, 0.1, yrgo::TrainMode::kBatch); 
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        EXPECT_NEAR(outputs[i], model.Predict(inputs[i]), 0.001); 
+    }
+}
+
+/********************************************************************************
+ * @brief Tests model trained to predict y = 3x - 5 during 1000 epochs with
+ *        mini-batches of two training sets and a learning rate of 5 %.
+ ********************************************************************************/
+TEST(LinRegTest, TrainMiniBatch) { 
+    const container::Vector<double> inputs{{0, 1, 2, 3, 4}};
+    const container::Vector<double> outputs{{-5, -2, 1, 4, 7}};
+    yrgo::LinReg model{inputs, outputs}; 
+    model.Train(1000, 0.05, yrgo::TrainMode::kMiniBatch, 2); 
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        EXPECT_NEAR(outputs[i], model.Predict(inputs[i]), 0.001); 
+    }
+}
+
+/********************************************************************************
+ * @brief Tests that online models observing separate parts of the samples
+ *        match a single model observing all samples after being merged.
+ ********************************************************************************/
+TEST(OnlineLinRegTest, Merge) { 
+    yrgo::OnlineLinReg all{}, first{}, second{};
+    for (int i{}; i < 10; ++i) {
+        const double x{0.5 * i}, y{3.0 * x - 2.0 + (i % 3) * 0.1};
+        all.Observe(x, y);
+        (i < 4 ? first : second).Observe(x, y);
+    }
+    first.Merge(second);
+    EXPECT_EQ(all.Count(), first.Count());
+    EXPECT_NEAR(all.Weight(), first.Weight(), 1e-12);
+    EXPECT_NEAR(all.Bias(), first.Bias(), 1e-12);
+}
+
+/********************************************************************************
+ * @brief Tests that fitting with multiple threads matches the single-threaded
+ *        closed-form solution and that the result is identical between runs.
+ ********************************************************************************/
+TEST(ParallelTrainerTest, Fit) { 
+    container::Vector<double> inputs{}, outputs{};
+    for (std::size_t i{}; i < 1000; ++i) {
+        inputs.PushBack(0.01 * i);
+        outputs.PushBack(2.5 * inputs[i] - 10.0 + ((i * 7) % 5) * 0.01);
+    }
+    yrgo::LinReg reference{inputs, outputs}, first{inputs, outputs}, second{inputs, outputs};
+    EXPECT_TRUE(reference.Fit());
+
+    yrgo::ParallelTrainer trainer{4};
+    EXPECT_EQ(4U, trainer.NumThreads());
+    EXPECT_TRUE(trainer.Fit(first));
+    EXPECT_TRUE(trainer.Fit(second));
+    EXPECT_NEAR(reference.Weight(), first.Weight(), 1e-9);
+    EXPECT_NEAR(reference.Bias(), first.Bias(), 1e-9);
+    EXPECT_EQ(first.Weight(), second.Weight());
+    EXPECT_EQ(first.Bias(), second.Bias());
+}
+
+/********************************************************************************
+ * @brief Tests that training with multiple threads matches full-batch training
+ *        of a model to predict y = 100x - 50 during 1000 epochs.
+ ********************************************************************************/
+TEST(ParallelTrainerTest, Train) { 
+    const container::Vector<double> inputs{{0, 1, 2, 3, 4}};
+    const container::Vector<double> outputs{{-50, 50, 150, 250, 350}};
+    yrgo::LinReg reference{inputs, outputs}, model{inputs, outputs};
+    reference.Train(1000, 0.1, yrgo::TrainMode::kBatch);
+
+    yrgo::ParallelTrainer trainer{3};
+    trainer.Train(model, 1000, 0.1);
+    EXPECT_NEAR(reference.Weight(), model.Weight(), 1e-9);
+    EXPECT_NEAR(reference.Bias(), model.Bias(), 1e-9);
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        EXPECT_NEAR(outputs[i], model.Predict(inputs[i]), 0.001); 
+    }
+}
+
+/********************************************************************************
+ * @brief Tests that the parameters in the units of standardized training data
+ *        predict the stored training data and convert back to the original
+ *        parameters of y = 100x - 50.
+ ********************************************************************************/
+TEST(LinRegTest, StandardizedParameters) { 
+    const container::Vector<double> inputs{{0, 1, 2, 3, 4}};
+    const container::Vector<double> outputs{{-50, 50, 150, 250, 350}};
+    yrgo::LinReg model{inputs, outputs, true};
+    model.SetParameters(100.0, -50.0);
+    double weight{}, bias{};
+    model.StandardizedParameters(weight, bias);
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        EXPECT_NEAR(model.TrainingOutputs()[i], weight * model.TrainingInputs()[i] + bias, 1e-12);
+    }
+    model.SetStandardizedParameters(weight, bias);
+    EXPECT_NEAR(100.0, model.Weight(), 1e-12);
+    EXPECT_NEAR(-50.0, model.Bias(), 1e-12);
+
+    yrgo::LinReg raw{inputs, outputs};
+    raw.SetParameters(2.0, 3.0);
+    raw.StandardizedParameters(weight, bias);
+    EXPECT_DOUBLE_EQ(2.0, weight);
+    EXPECT_DOUBLE_EQ(3.0, bias);
+}
+
+/********************************************************************************
+ * @brief Tests that models with the same seed are trained identically in
+ *        stochastic mode, while models with different seeds are not.
+ ********************************************************************************/
+TEST(LinRegTest, Seed) { 
+    const container::Vector<double> inputs{{0, 1, 2, 3, 4, 5, 6, 7}};
+    const container::Vector<double> outputs{{-5, -2, 1, 4, 7, 10, 13, 16}};
+    yrgo::LinReg first{inputs, outputs}, second{inputs, outputs}, other{inputs, outputs}; 
+    first.Seed(42);
+    second.Seed(42);
+    other.Seed(43);
+    first.Train(10);
+    second.Train(10);
+    other.Train(10);
+    EXPECT_EQ(first.Weight(), second.Weight());
+    EXPECT_EQ(first.Bias(), second.Bias());
+    EXPECT_NE(first.Weight(), other.Weight());
+}
+
+/********************************************************************************
+ * @brief Tests that all six orders of three elements are equally likely when
+ *        shuffled with the Fisher-Yates algorithm (within 5 % of 10000 each).
+ ********************************************************************************/
+TEST(RandomTest, Shuffle) { 
+    yrgo::random::Xorshift32 generator{};
+    std::size_t counts[6]{};
+    for (std::size_t i{}; i < 60000; ++i) {
+        int data[3]{0, 1, 2};
+        yrgo::random::Shuffle(data, 3, generator);
+        EXPECT_EQ(3, data[0] + data[1] + data[2]);
+        EXPECT_TRUE(data[0] != data[1] && data[1] != data[2] && data[0] != data[2]);
+        counts[data[0] * 2 + (data[1] > data[2])]++;
+    }
+    for (const auto& count : counts) {
+        EXPECT_NEAR(10000.0, count, 500.0);
+    }
+}
+
+/********************************************************************************
+ * @brief Tests model trained to predict y = 3x - 5 during 1000 epochs with a
+ *        learning rate of 1 %, where the training order is generated by an 
+ *        affine permutation instead of shuffling.
+ ********************************************************************************/
+TEST(LinRegTest, TrainAffineOrder) { 
+    const container::Vector<double> inputs{{0, 1, 2, 3, 4}};
+    const container::Vector<double> outputs{{-5, -2, 1, 4, 7}};
+    yrgo::LinReg model{inputs, outputs}; 
+    model.SetTrainOrder(yrgo::TrainOrder::kAffine);
+    model.Train(1000); 
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        EXPECT_NEAR(outputs[i], model.Predict(inputs[i]), 0.001); 
+    }
+}
+
+/********************************************************************************
+ * @brief Tests that affine permutations of 1 - 100 indexes visit each index
+ *        exactly once per permutation.
+ ********************************************************************************/
+TEST(RandomTest, AffinePermutation) { 
+    yrgo::random::Xorshift32 generator{};
+    for (std::size_t size{1}; size <= 100; ++size) {
+        yrgo::random::AffinePermutation order{size, generator};
+        bool visited[100]{};
+        for (std::size_t i{}; i < size; ++i) {
+            const auto index{order.Next()};
+            ASSERT_LT(index, size);
+            EXPECT_FALSE(visited[index]);
+            visited[index] = true;
+        }
+    }
+}
+
+/********************************************************************************
+ * @brief Tests that training is stopped once the parameters have converged,
+ *        i.e. changed less than 1e-9 during three consecutive epochs, while
+ *        all epochs are trained if the tolerance isn't reached.
+ ********************************************************************************/
+TEST(LinRegTest, TrainEarlyStopping) { 
+    const container::Vector<double> inputs{{0, 1, 2, 3, 4}};
+    const container::Vector<double> outputs{{-50, 50, 150, 250, 350}};
+    yrgo::LinReg model{inputs, outputs}; 
+    EXPECT_EQ(10U, model.Train(10, 0.1, yrgo::TrainMode::kBatch));
+    const auto num_epochs{model.Train(10000, 0.1, yrgo::TrainMode::kBatch, 32, 1e-9, 3)};
+    EXPECT_GT(num_epochs, 3U);
+    EXPECT_LT(num_epochs, 1000U);
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        EXPECT_NEAR(outputs[i], model.Predict(inputs[i]), 0.001); 
+    }
+}
+
+/********************************************************************************
+ * @brief Trains a model to predict y = 100x - 50 with full-batch gradient descent
+ *        and specified optimizer until the parameters change less than 1e-6 during
+ *        five consecutive epochs, verifies the predictions and returns the number
+ *        of epochs required.
+ ********************************************************************************/
+template <template <typename> class Optimizer>
+std::size_t EpochsToConverge(const double learning_rate) {
+    const container::Vector<double> inputs{{0, 1, 2, 3, 4}};
+    const container::Vector<double> outputs{{-50, 50, 150, 250, 350}};
+    yrgo::LinReg<double, Optimizer> model{inputs, outputs}; 
+    const auto num_epochs{model.Train(10000, learning_rate, yrgo::TrainMode::kBatch, 32, 1e-6, 5)};
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        EXPECT_NEAR(outputs[i], model.Predict(inputs[i]), 0.001); 
+    }
+    return num_epochs;
+}
+
+/********************************************************************************
+ * @brief Tests that all optimizers converge, where momentum shall require fewer
+ *        epochs than plain gradient descent with the same learning rate.
+ ********************************************************************************/
+TEST(OptimizerTest, Converge) { 
+    const auto sgd_epochs{EpochsToConverge<optimizer::Sgd>(0.05)};
+    EXPECT_LT(sgd_epochs, 10000U);
+    EXPECT_LT(EpochsToConverge<optimizer::Momentum>(0.05), sgd_epochs);
+    EXPECT_LT(EpochsToConverge<optimizer::Nesterov>(0.05), sgd_epochs);
+    EXPECT_LT(EpochsToConverge<optimizer::AdaGrad>(30), 10000U);
+    EXPECT_LT(EpochsToConverge<optimizer::Adam>(5), 10000U);
+}
+
+/********************************************************************************
+ * @brief Tests model trained to predict y = 3x - 5 with momentum and Q16.16
+ *        fixed-point numbers, where the optimizer uses fixed point as well.
+ ********************************************************************************/
+TEST(OptimizerTest, FixedPointMomentum) { 
+    container::Vector<fixed::Q16_16> inputs{}, outputs{};
+    for (int i{}; i < 5; ++i) {
+        inputs.PushBack(fixed::Q16_16{static_cast<double>(i)});
+        outputs.PushBack(fixed::Q16_16{3.0 * i - 5.0});
+    }
+    yrgo::LinReg<fixed::Q16_16, optimizer::Momentum> model{inputs, outputs}; 
+    model.SetOptimizer(optimizer::Momentum<fixed::Q16_16>{fixed::Q16_16{0.8}});
+    model.Train(1000, fixed::Q16_16{0.05}, yrgo::TrainMode::kBatch); 
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        EXPECT_NEAR(static_cast<double>(outputs[i]), static_cast<double>(model.Predict(inputs[i])), 0.01); 
+    }
+}
+
+/********************************************************************************
+ * @brief Tests that the automatic learning rate (0) trains a model to predict 
+ *        y = 3x - 5 on inputs 0 - 190, where the default learning rate diverges.
+ ********************************************************************************/
+TEST(LinRegTest, AutoLearningRate) { 
+    container::Vector<double> inputs{}, outputs{};
+    for (std::size_t i{}; i < 20; ++i) {
+        inputs.PushBack(10.0 * i);
+        outputs.PushBack(30.0 * i - 5.0);
+    }
+    yrgo::LinReg model{inputs, outputs}; 
+    EXPECT_DOUBLE_EQ(1.0 / (190.0 * 190.0 + 1.0), model.AutoLearningRate(yrgo::TrainMode::kStochastic));
+    EXPECT_LT(model.Train(1000, 0.0, yrgo::TrainMode::kStochastic, 32, 1e-6, 5), 100U);
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        EXPECT_NEAR(outputs[i], model.Predict(inputs[i]), 0.001); 
+    }
+}
+
+/********************************************************************************
+ * @brief Tests the learning rates calculated by the learning-rate schedules.
+ ********************************************************************************/
+TEST(ScheduleTest, Rate) { 
+    EXPECT_DOUBLE_EQ(0.1, yrgo::Schedule{}.Rate(0.1, 50));
+    EXPECT_DOUBLE_EQ(0.1, yrgo::Schedule::Step(0.5, 10).Rate(0.1, 9));
+    EXPECT_DOUBLE_EQ(0.025, yrgo::Schedule::Step(0.5, 10).Rate(0.1, 25));
+    EXPECT_DOUBLE_EQ(0.1 * 0.9 * 0.9, yrgo::Schedule::Exponential(0.9).Rate(0.1, 2));
+    EXPECT_DOUBLE_EQ(0.1, yrgo::Schedule::Cosine(100).Rate(0.1, 0));
+    EXPECT_NEAR(0.05, yrgo::Schedule::Cosine(100).Rate(0.1, 50), 1e-12);
+    EXPECT_DOUBLE_EQ(0.0, yrgo::Schedule::Cosine(100).Rate(0.1, 100));
+    EXPECT_DOUBLE_EQ(0.05, yrgo::Schedule::InverseTime(0.1).Rate(0.1, 10));
+}
+
+/********************************************************************************
+ * @brief Tests that standardized training data reduces the number of full-batch
+ *        epochs required to predict y = 100x - 50 by an order of magnitude,
+ *        while the parameters are still returned in the original units.
+ ********************************************************************************/
+TEST(LinRegTest, Standardize) { 
+    const container::Vector<double> inputs{{0, 1, 2, 3, 4}};
+    const container::Vector<double> outputs{{-50, 50, 150, 250, 350}};
+    yrgo::LinReg raw{inputs, outputs}, standardized{inputs, outputs, true}; 
+    EXPECT_FALSE(raw.Standardized());
+    EXPECT_TRUE(standardized.Standardized());
+    EXPECT_NEAR(0.0, standardized.TrainingInputs()[2], 1e-12);
+    const auto raw_epochs{raw.Train(10000, 0.0, yrgo::TrainMode::kBatch, 32, 1e-6, 5)};
+    const auto standardized_epochs{standardized.Train(10000, 0.0, yrgo::TrainMode::kBatch, 32, 1e-6, 5)};
+    EXPECT_LT(standardized_epochs * 10, raw_epochs);
+    EXPECT_NEAR(100.0, standardized.Weight(), 0.001);
+    EXPECT_NEAR(-50.0, standardized.Bias(), 0.001);
+
+    yrgo::LinReg fitted{inputs, outputs, true}; 
+    EXPECT_TRUE(fitted.Fit());
+    EXPECT_NEAR(100.0, fitted.Weight(), 1e-9);
+    EXPECT_NEAR(-50.0, fitted.Bias(), 1e-9);
+}
+
+/********************************************************************************
+ * @brief Tests that the parallel trainer returns the parameters in the original
+ *        units when the training data is standardized.
+ ********************************************************************************/
+TEST(ParallelTrainerTest, Standardized) { 
+    const container::Vector<double> inputs{{0, 10, 20, 30, 40}};
+    const container::Vector<double> outputs{{-50, 50, 150, 250, 350}};
+    yrgo::LinReg fitted{inputs, outputs, true}, trained{inputs, outputs, true};
+    yrgo::ParallelTrainer trainer{2};
+    EXPECT_TRUE(trainer.Fit(fitted));
+    EXPECT_NEAR(10.0, fitted.Weight(), 1e-9);
+    EXPECT_NEAR(-50.0, fitted.Bias(), 1e-9);
+    trainer.Train(trained, 100, 0.5);
+    EXPECT_NEAR(10.0, trained.Weight(), 0.001);
+    EXPECT_NEAR(-50.0, trained.Bias(), 0.001);
+}
+
+/********************************************************************************
+ * @brief Creates training data for y = 2a - 3b + 0.5c + 1 with features a, b
+ *        and c on a 4 x 4 x 4 grid, stored in row-major order.
+ ********************************************************************************/
+void CreateMultiTrainingData(container::Vector<double>& inputs, container::Vector<double>& outputs) {
+    for (int a{}; a < 4; ++a) {
+        for (int b{}; b < 4; ++b) {
+            for (int c{}; c < 4; ++c) {
+                inputs += {static_cast<double>(a), static_cast<double>(b), static_cast<double>(c)};
+                outputs.PushBack(2.0 * a - 3.0 * b + 0.5 * c + 1.0);
+            }
+        }
+    }
+}
+
+/********************************************************************************
+ * @brief Tests multivariate model with three features fitted via the normal
+ *        equations and trained with stochastic gradient descent.
+ ********************************************************************************/
+TEST(MultiLinRegTest, FitAndTrain) { 
+    container::Vector<double> inputs{}, outputs{};
+    CreateMultiTrainingData(inputs, outputs);
+    yrgo::MultiLinReg<3> fitted{}, trained{};
+    EXPECT_EQ(3U, fitted.NumFeatures());
+    EXPECT_TRUE(fitted.LoadTrainingData(inputs, outputs));
+    EXPECT_TRUE(trained.LoadTrainingData(inputs, outputs));
+    EXPECT_TRUE(fitted.Fit());
+    EXPECT_NEAR(2.0, fitted.Weight(0), 1e-9);
+    EXPECT_NEAR(-3.0, fitted.Weight(1), 1e-9);
+    EXPECT_NEAR(0.5, fitted.Weight(2), 1e-9);
+    EXPECT_NEAR(1.0, fitted.Bias(), 1e-9);
+
+    EXPECT_LT(trained.Train(10000, 0.0, 1e-9, 5), 10000U);
+    const double input[]{1.5, -2.0, 4.0};
+    EXPECT_NEAR(fitted.Predict(input), trained.Predict(input), 0.001);
+    EXPECT_NEAR(12.0, trained.Predict(input), 0.001);
+}
+
+/********************************************************************************
+ * @brief Tests multivariate model with the number of features specified at
+ *        runtime, which shall fail to fit linearly dependent features.
+ ********************************************************************************/
+TEST(MultiLinRegTest, DynLinReg) { 
+    container::Vector<double> inputs{}, outputs{};
+    CreateMultiTrainingData(inputs, outputs);
+    yrgo::DynLinReg<> model{3};
+    EXPECT_TRUE(model.LoadTrainingData(inputs, outputs));
+    EXPECT_TRUE(model.Fit());
+    EXPECT_NEAR(0.5, model.Weight(2), 1e-9);
+    EXPECT_NEAR(1.0, model.Bias(), 1e-9);
+
+    const double dependent[]{1, 2, 2, 4, 3, 6};
+    const double references[]{1, 2, 3};
+    yrgo::DynLinReg<> degenerate{2};
+    EXPECT_TRUE(degenerate.LoadTrainingData(dependent, references, 3));
+    EXPECT_FALSE(degenerate.Fit());
+}
+
+/********************************************************************************
+ * @brief Creates training data for y = 0.5x^3 - 2x^2 + x + 25 with 51 inputs
+ *        within [0, 5], which resembles the curve of a thermistor.
+ ********************************************************************************/
+template <typename T>
+void CreatePolyTrainingData(container::Vector<T>& inputs, container::Vector<T>& outputs) {
+    for (int i{}; i <= 50; ++i) {
+        const double x{0.1 * i};
+        inputs.PushBack(T{x});
+        outputs.PushBack(T{0.5 * x * x * x - 2 * x * x + x + 25});
+    }
+}
+
+/********************************************************************************
+ * @brief Tests cubic model fitted via the normal equations and trained with
+ *        stochastic gradient descent, which shall fail to fit too few inputs.
+ ********************************************************************************/
+TEST(PolyRegTest, FitAndTrain) { 
+    container::Vector<double> inputs{}, outputs{};
+    CreatePolyTrainingData(inputs, outputs);
+    yrgo::PolyReg<3> fitted{inputs, outputs}, trained{inputs, outputs};
+    EXPECT_DOUBLE_EQ(2.5, fitted.Center());
+    EXPECT_DOUBLE_EQ(0.4, fitted.Scale());
+    EXPECT_TRUE(fitted.Fit());
+    for (double x{-1.0}; x <= 6.0; x += 0.25) {
+        EXPECT_NEAR(0.5 * x * x * x - 2 * x * x + x + 25, fitted.Predict(x), 1e-9);
+    }
+
+    EXPECT_LT(trained.Train(100000, 0.0, 1e-9, 5), 100000U);
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        EXPECT_NEAR(outputs[i], trained.Predict(inputs[i]), 0.001);
+    }
+
+    const container::Vector<double> few{{1, 2, 2, 1}};
+    yrgo::PolyReg<2> degenerate{few, few};
+    EXPECT_FALSE(degenerate.Fit());
+    EXPECT_DOUBLE_EQ(0.0, degenerate.Coefficient(2));
+}
+
+/********************************************************************************
+ * @brief Tests cubic model with Q16.16 fixed-point numbers, which is fitted
+ *        with double precision and evaluated with integer instructions only.
+ ********************************************************************************/
+TEST(PolyRegTest, FixedPoint) { 
+    container::Vector<fixed::Q16_16> inputs{}, outputs{};
+    CreatePolyTrainingData(inputs, outputs);
+    yrgo::PolyReg<3, fixed::Q16_16> model{inputs, outputs};
+    EXPECT_TRUE(model.Fit());
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        EXPECT_NEAR(static_cast<double>(outputs[i]), 
+                    static_cast<double>(model.Predict(inputs[i])), 0.001);
+    }
+}
+
+/********************************************************************************
+ * @brief Creates training data for y = 3|x - 2| + 1 with 41 inputs within [0, 4],
+ *        which is linear within each half of the input range.
+ ********************************************************************************/
+void CreatePiecewiseTrainingData(container::Vector<double>& inputs, container::Vector<double>& outputs) {
+    for (int i{}; i <= 40; ++i) {
+        const double x{0.1 * i};
+        inputs.PushBack(x);
+        outputs.PushBack(3 * (x < 2 ? 2 - x : x - 2) + 1);
+    }
+}
+
+/********************************************************************************
+ * @brief Tests piecewise-linear model with four segments, where the kink of
+ *        the training data lies on a segment boundary.
+ ********************************************************************************/
+TEST(PiecewiseLinRegTest, Fit) { 
+    container::Vector<double> inputs{}, outputs{};
+    CreatePiecewiseTrainingData(inputs, outputs);
+    yrgo::PiecewiseLinReg<4> fitted{inputs, outputs}, trained{inputs, outputs, true};
+    EXPECT_EQ(0U, fitted.SegmentIndex(-5.0));
+    EXPECT_EQ(1U, fitted.SegmentIndex(1.5));
+    EXPECT_EQ(2U, fitted.SegmentIndex(2.0));
+    EXPECT_EQ(3U, fitted.SegmentIndex(4.0));
+    EXPECT_EQ(3U, fitted.SegmentIndex(10.0));
+    EXPECT_TRUE(fitted.Fit());
+    EXPECT_NEAR(-3.0, fitted.GetSegment(1).Weight(), 1e-9);
+    EXPECT_NEAR(3.0, fitted.GetSegment(2).Weight(), 1e-9);
+    for (double x{-1.0}; x <= 5.0; x += 0.125) {
+        EXPECT_NEAR(3 * (x < 2 ? 2 - x : x - 2) + 1, fitted.Predict(x), 1e-9);
+    }
+
+    trained.Train(10000, 0.0, TrainMode::kBatch, 32, 1e-9, 5);
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        EXPECT_NEAR(outputs[i], trained.Predict(inputs[i]), 0.001);
+    }
+}
+
+/********************************************************************************
+ * @brief Tests that eight segments approximate a cubic curve at least ten
+ *        times more accurately than a single line.
+ ********************************************************************************/
+TEST(PiecewiseLinRegTest, Accuracy) { 
+    container::Vector<double> inputs{}, outputs{};
+    CreatePolyTrainingData(inputs, outputs);
+    yrgo::PiecewiseLinReg<8> piecewise{inputs, outputs};
+    yrgo::LinReg<> line{inputs, outputs};
+    EXPECT_TRUE(piecewise.Fit());
+    EXPECT_TRUE(line.Fit());
+
+    double piecewise_error{}, line_error{};
+    for (std::size_t i{}; i < inputs.Size(); ++i) {
+        piecewise_error = std::max(piecewise_error, std::abs(piecewise.Predict(inputs[i]) - outputs[i]));
+        line_error = std::max(line_error, std::abs(line.Predict(inputs[i]) - outputs[i]));
+    }
+    EXPECT_LT(10 * piecewise_error, line_error);
+}
+
+/********************************************************************************
+ * @brief Tests that inputs far outside the range of the training data, or
+ *        infinite, are clamped to the first and last segment.
+ ********************************************************************************/
+TEST(PiecewiseLinRegTest, OutOfRange) { 
+    container::Vector<double> inputs{}, outputs{};
+    CreatePolyTrainingData(inputs, outputs);
+    yrgo::PiecewiseLinReg<8> model{};
+    EXPECT_TRUE(model.LoadTrainingData(inputs, outputs));
+    EXPECT_EQ(7U, model.SegmentIndex(1e300));
+    EXPECT_EQ(7U, model.SegmentIndex(std::numeric_limits<double>::infinity()));
+    EXPECT_EQ(0U, model.SegmentIndex(-1e300));
+    EXPECT_EQ(0U, model.SegmentIndex(-std::numeric_limits<double>::infinity()));
+    EXPECT_EQ(0U, model.SegmentIndex(std::numeric_limits<double>::quiet_NaN()));
+}
+
+/********************************************************************************
+ * @brief Tests that every training set is loaded into exactly one segment and
+ *        that loading empty training data clears the segments and the range.
+ ********************************************************************************/
+TEST(PiecewiseLinRegTest, Reload) { 
+    container::Vector<double> inputs{}, outputs{};
+    CreatePiecewiseTrainingData(inputs, outputs);
+    yrgo::PiecewiseLinReg<4> model{inputs, outputs, true};
+    std::size_t num_sets{};
+    for (std::size_t s{}; s < model.NumSegments(); ++s) {
+        const auto& segment{model.GetSegment(s)};
+        EXPECT_EQ(segment.TrainingInputs().Size(), segment.TrainingOutputs().Size());
+        EXPECT_TRUE(segment.Standardized());
+        num_sets += segment.TrainingInputs().Size();
+    }
+    EXPECT_EQ(inputs.Size(), num_sets);
+
+    EXPECT_TRUE(model.LoadTrainingData(container::Vector<double>{}, container::Vector<double>{}));
+    for (std::size_t s{}; s < model.NumSegments(); ++s) {
+        EXPECT_EQ(0U, model.GetSegment(s).TrainingInputs().Size());
+        EXPECT_EQ(0U, model.GetSegment(s).TrainingOutputs().Size());
+    }
+    EXPECT_EQ(0U, model.SegmentIndex(inputs[inputs.Size() - 1]));
+    EXPECT_FALSE(model.Fit());
+}
+
+/********************************************************************************
+ * @brief Tests that the segments fitted in parallel equal the segments fitted
+ *        sequentially.
+ ********************************************************************************/
+TEST(ParallelTrainerTest, Piecewise) { 
+    container::Vector<double> inputs{}, outputs{};
+    CreatePolyTrainingData(inputs, outputs);
+    yrgo::PiecewiseLinReg<8> sequential{inputs, outputs}, parallel{inputs, outputs};
+    EXPECT_TRUE(sequential.Fit());
+    EXPECT_TRUE(yrgo::ParallelTrainer{3}.Fit(parallel));
+    for (std::size_t i{}; i < sequential.NumSegments(); ++i) {
+        EXPECT_EQ(sequential.GetSegment(i).Weight(), parallel.GetSegment(i).Weight());
+        EXPECT_EQ(sequential.GetSegment(i).Bias(), parallel.GetSegment(i).Bias());
+    }
+
+    yrgo::PiecewiseLinReg<8> sparse{{{0.0, 1.0, 2.0}}, {{0.0, 1.0, 4.0}}};
+    EXPECT_FALSE(yrgo::ParallelTrainer{2}.Fit(sparse));
+}
+
+/********************************************************************************
+ * @brief Tests that the lookup table sampled from a piecewise-linear model
+ *        predicts the rounded output for every 10-bit ADC code.
+ ********************************************************************************/
+TEST(LookupTableTest, Sample) { 
+    static constexpr double kInputScale{4.0 / 1023};
+    container::Vector<double> inputs{}, outputs{};
+    CreatePiecewiseTrainingData(inputs, outputs);
+    yrgo::PiecewiseLinReg<4> model{inputs, outputs};
+    EXPECT_TRUE(model.Fit());
+    yrgo::LookupTable<> table{};
+    table.Sample(model, kInputScale);
+
+    for (std::uint16_t code{}; code <= 1023; ++code) {
+        const auto prediction{model.Predict(code * kInputScale)};
+        EXPECT_LE(std::abs(table.Lookup(code) - prediction), 0.6);
+    }
+    EXPECT_EQ(7, table.Lookup(0));
+    EXPECT_EQ(1, table.Lookup(512));
+}
+
+/********************************************************************************
+ * @brief Tests that a saved model is restored exactly, while buffers that are
+ *        too small, corrupted or saved with another scalar type are rejected.
+ ********************************************************************************/
+TEST(LinRegTest, SaveLoad) { 
+    const yrgo::LinReg<double> model{100.0, -50.25};
+    std::uint8_t data[yrgo::LinReg<double>::kSerializedSize]{};
+    EXPECT_EQ(23U, sizeof(data));
+    EXPECT_FALSE(model.Save(data, sizeof(data) - 1));
+    EXPECT_TRUE(model.Save(data, sizeof(data)));
+
+    yrgo::LinReg<double> restored{};
+    EXPECT_FALSE(restored.Load(data, sizeof(data) - 1));
+    EXPECT_TRUE(restored.Load(data, sizeof(data)));
+    EXPECT_EQ(100.0, restored.Weight());
+    EXPECT_EQ(-50.25, restored.Bias());
+
+    data[7] ^= 0x10;
+    yrgo::LinReg<double> corrupted{1.0, 2.0};
+    EXPECT_FALSE(corrupted.Load(data, sizeof(data)));
+    EXPECT_EQ(1.0, corrupted.Weight());
+    EXPECT_EQ(2.0, corrupted.Bias());
+
+    const yrgo::LinReg<fixed::Q16_16> fixed_model{fixed::Q16_16{1.5}, fixed::Q16_16{-0.75}};
+    std::uint8_t fixed_data[yrgo::LinReg<fixed::Q16_16>::kSerializedSize]{};
+    EXPECT_TRUE(fixed_model.Save(fixed_data, sizeof(fixed_data)));
+    yrgo::LinReg<fixed::Q8_24> other_type{};
+    EXPECT_FALSE(other_type.Load(fixed_data, sizeof(fixed_data)));
+    yrgo::LinReg<fixed::Q16_16> fixed_restored{};
+    EXPECT_TRUE(fixed_restored.Load(fixed_data, sizeof(fixed_data)));
+    EXPECT_EQ(fixed_model.Weight(), fixed_restored.Weight());
+    EXPECT_EQ(fixed_model.Bias(), fixed_restored.Bias());
+}
+
+/********************************************************************************
+ * @brief Tests the CRC-16 checksum against the check value of CRC-16/CCITT-FALSE.
+ ********************************************************************************/
+TEST(CrcTest, Crc16) { 
+    static constexpr std::uint8_t kData[]{'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    static_assert(crc::Crc16(kData, sizeof(kData)) == 0x29B1, "Invalid checksum!");
+    EXPECT_EQ(0x29B1, crc::Crc16(kData + 4, 5, crc::Crc16(kData, 4)));
+    EXPECT_EQ(crc::kCrc16Init, crc::Crc16(kData, 0));
+}
+
+/********************************************************************************
+ * @brief Memory policy emulating a 256-byte EEPROM in RAM, which counts the
+ *        writes of each address. Each write keeps the memory busy during the
+ *        following call to Ready.
+ ********************************************************************************/
+struct FakeEeprom {
+    static inline std::uint8_t data[256]{};
+    static inline std::size_t writes[256]{};
+    static inline bool busy{};
+
+    static void Erase(void) {
+        for (std::size_t i{}; i < 256; ++i) {
+            data[i] = 0xFF;
+            writes[i] = 0;
+        }
+    }
+    static bool Ready(void) { return !busy || (busy = false); }
+    static std::uint8_t ReadByte(const std::uint16_t address) { return data[address]; }
+    static void WriteByte(const std::uint16_t address, const std::uint8_t value) {
+        data[address] = value;
+        ++writes[address];
+        busy = true;
+    }
+};
+
+/********************************************************************************
+ * @brief Tests that the records are rotated across all slots, that unchanged
+ *        records and bytes aren't rewritten and that the newest record is
+ *        found after a reset, also after the sequence number wraps around.
+ ********************************************************************************/
+TEST(LogStoreTest, WearLeveling) { 
+    using Store = yrgo::LogStore<4, FakeEeprom>;
+    FakeEeprom::Erase();
+    Store store{0, 256};
+    EXPECT_EQ(32U, store.NumSlots());
+    std::uint8_t record[4]{};
+    EXPECT_FALSE(store.Valid());
+    EXPECT_FALSE(store.Read(record));
+
+    for (std::uint32_t i{}; i < 70000; ++i) {
+        const std::uint8_t value[4]{static_cast<std::uint8_t>(i), 0x12, 0x34, 0x56};
+        EXPECT_TRUE(store.Write(value));
+        EXPECT_TRUE(store.Pending());
+        while (store.Service());
+    }
+    EXPECT_TRUE(store.Read(record));
+    EXPECT_EQ(static_cast<std::uint8_t>(69999), record[0]);
+
+    std::size_t max_writes{}, total_writes{};
+    for (std::size_t i{}; i < 256; ++i) {
+        max_writes = std::max(max_writes, FakeEeprom::writes[i]);
+        total_writes += FakeEeprom::writes[i];
+    }
+    EXPECT_LE(max_writes, 70000U / 32 + 1);
+    EXPECT_LT(total_writes, 70000U * (Store::kSlotSize - 3));
+
+    const std::uint8_t same[4]{static_cast<std::uint8_t>(69999), 0x12, 0x34, 0x56};
+    EXPECT_TRUE(store.Write(same));
+    EXPECT_FALSE(store.Pending());
+
+    const Store remounted{0, 256};
+    std::uint8_t restored[4]{};
+    EXPECT_TRUE(remounted.Read(restored));
+    EXPECT_TRUE(std::equal(record, record + 4, restored));
+}
+
+/********************************************************************************
+ * @brief Tests that a record interrupted by a reset is discarded, so that the
+ *        previous record is kept, and that writes never wait for the memory.
+ ********************************************************************************/
+TEST(LogStoreTest, InterruptedWrite) { 
+    using Store = yrgo::LogStore<4, FakeEeprom>;
+    FakeEeprom::Erase();
+    Store store{16, 64};
+    const std::uint8_t first[4]{1, 2, 3, 4}, second[4]{5, 6, 7, 8};
+    store.Write(first);
+    while (store.Service());
+
+    store.Write(second);
+    EXPECT_TRUE(store.Service());
+    EXPECT_TRUE(store.Service());
+    EXPECT_EQ(1U, std::count(FakeEeprom::writes + 24, FakeEeprom::writes + 32, 1U));
+
+    const Store remounted{16, 64};
+    std::uint8_t record[4]{};
+    EXPECT_TRUE(remounted.Read(record));
+    EXPECT_TRUE(std::equal(first, first + 4, record));
+    for (std::size_t i{}; i < 16; ++i) {
+        EXPECT_EQ(0U, FakeEeprom::writes[i]);
+    }
+}
+
+/********************************************************************************
+ * @brief Tests that the capacity of a container::Vector grows geometrically
+ *        when pushing values and is kept when popping and shrinking the size.
+ ********************************************************************************/
+TEST(VectorTest, Capacity) { 
+    container::Vector<int> values{};
+    std::size_t reallocations{};
+    for (int i{}; i < 1000; ++i) {
+        const auto capacity{values.Capacity()};
+        EXPECT_TRUE(values.PushBack(i));
+        if (values.Capacity() != capacity) ++reallocations;
+        EXPECT_GE(values.Capacity(), values.Size());
+    }
+    EXPECT_LT(reallocations, 20U);
+    for (int i{}; i < 1000; ++i) {
+        EXPECT_EQ(i, values[i]);
+    }
+
+    const auto capacity{values.Capacity()};
+    EXPECT_TRUE(values.PopBack());
+    EXPECT_TRUE(values.Resize(10));
+    EXPECT_EQ(10U, values.Size());
+    EXPECT_EQ(capacity, values.Capacity());
+    EXPECT_EQ(9, values[9]);
+
+    EXPECT_TRUE(values.ShrinkToFit());
+    EXPECT_EQ(10U, values.Capacity());
+    EXPECT_TRUE(values.Reserve(100));
+    EXPECT_EQ(100U, values.Capacity());
+    EXPECT_EQ(10U, values.Size());
+    EXPECT_TRUE(values.Reserve(50));
+    EXPECT_EQ(100U, values.Capacity());
+
+    container::Vector<int> moved{static_cast<container::Vector<int>&&>(values)};
+    EXPECT_EQ(100U, moved.Capacity());
+    EXPECT_EQ(0U, values.Capacity());
+    while (moved.Size() > 0) moved.PopBack();
+    EXPECT_TRUE(moved.PopBack());
+    EXPECT_TRUE(moved.ShrinkToFit());
+    EXPECT_EQ(0U, moved.Capacity());
+    EXPECT_EQ(nullptr, moved.Data());
+}
+
+/********************************************************************************
+ * @brief Element counting its live instances, copies and moves, which isn't
+ *        trivially copyable.
+ ********************************************************************************/
+struct Tracked {
+    static inline int instances{}, copies{}, moves{};
+    int value{};
+
+    Tracked(const int value = 0) : value{value} { ++instances; }
+    Tracked(const Tracked& source) : value{source.value} { ++instances; ++copies; }
+    Tracked(Tracked&& source) : value{source.value} { ++instances; ++moves; source.value = -1; }
+    ~Tracked(void) { --instances; }
+    Tracked& operator=(const Tracked& source) { value = source.value; ++copies; return *this; }
+};
+
+/********************************************************************************
+ * @brief Tests that non-trivial elements are constructed in place, moved when
+ *        the container::Vector grows and destroyed when removed.
+ ********************************************************************************/
+TEST(VectorTest, NonTrivialElements) { 
+    static_assert(type_traits::is_trivially_copyable<double>::value, "");
+    static_assert(type_traits::is_trivially_copyable<fixed::Q16_16>::value, "");
+    static_assert(!type_traits::is_trivially_copyable<Tracked>::value, "");
+    static_assert(!type_traits::is_trivially_copyable<container::Vector<double>>::value, "");
+    {
+        container::Vector<Tracked> values{};
+        for (int i{}; i < 100; ++i) {
+            EXPECT_TRUE(values.EmplaceBack(i));
+        }
+        EXPECT_EQ(100, Tracked::instances);
+        EXPECT_EQ(0, Tracked::copies);
+        EXPECT_GT(Tracked::moves, 0);
+        for (int i{}; i < 100; ++i) {
+            EXPECT_EQ(i, values[i].value);
+        }
+
+        EXPECT_TRUE(values.ShrinkToFit());
+        EXPECT_TRUE(values.PushBack(values[0]));
+        EXPECT_EQ(0, values[100].value);
+        EXPECT_EQ(1, Tracked::copies);
+        EXPECT_TRUE(values.PopBack());
+        EXPECT_TRUE(values.Resize(10));
+        EXPECT_EQ(10, Tracked::instances);
+
+        container::Vector<Tracked> copy{values};
+        EXPECT_EQ(20, Tracked::instances);
+        copy = container::Vector<Tracked>{};
+        EXPECT_EQ(10, Tracked::instances);
+    }
+    EXPECT_EQ(0, Tracked::instances);
+
+    container::Vector<container::Vector<double>> nested{};
+    container::Vector<double> inner{{1.0, 2.0, 3.0}};
+    const auto data{inner.Data()};
+    EXPECT_TRUE(nested.PushBack(static_cast<container::Vector<double>&&>(inner)));
+    for (int i{}; i < 100; ++i) {
+        EXPECT_TRUE(nested.EmplaceBack(static_cast<std::size_t>(i)));
+    }
+    EXPECT_EQ(nullptr, inner.Data());
+    EXPECT_EQ(data, nested[0].Data());
+    EXPECT_EQ(3.0, nested[0][2]);
+    EXPECT_EQ(99U, nested[100].Size());
+}
+
+/********************************************************************************
+ * @brief Indicates if the elements of referenced container are stored within 
+ *        the container object itself.
+ ********************************************************************************/
+template <typename Container>
+bool StoredInline(const Container& container) {
+    const auto address{reinterpret_cast<const char*>(container.Data())};
+    const auto object{reinterpret_cast<const char*>(&container)};
+    return address >= object && address < object + sizeof(container);
+}
+
+/********************************************************************************
+ * @brief Tests that up to N elements are stored inline, after which the
+ *        elements spill to the heap, and that they return inline when shrunk.
+ ********************************************************************************/
+TEST(SmallVectorTest, InlineAndSpill) { 
+    container::SmallVector<int, 4> values{{0, 1, 2}};
+    EXPECT_TRUE(StoredInline(values));
+    EXPECT_EQ(4U, values.Capacity());
+    EXPECT_TRUE(values.PushBack(3));
+    EXPECT_TRUE(StoredInline(values));
+
+    for (int i{4}; i < 100; ++i) {
+        EXPECT_TRUE(values.PushBack(i));
+    }
+    EXPECT_FALSE(StoredInline(values));
+    EXPECT_GE(values.Capacity(), 100U);
+    for (int i{}; i < 100; ++i) {
+        EXPECT_EQ(i, values[i]);
+    }
+
+    container::SmallVector<int, 4> copy{values};
+    EXPECT_FALSE(StoredInline(copy));
+    EXPECT_EQ(99, copy[99]);
+    container::SmallVector<int, 4> moved{static_cast<container::SmallVector<int, 4>&&>(copy)};
+    EXPECT_EQ(0U, copy.Size());
+    EXPECT_TRUE(StoredInline(copy));
+    EXPECT_EQ(100U, moved.Size());
+
+    EXPECT_TRUE(values.Resize(3));
+    EXPECT_TRUE(values.ShrinkToFit());
+    EXPECT_TRUE(StoredInline(values));
+    EXPECT_EQ(4U, values.Capacity());
+    EXPECT_EQ(2, values[2]);
+    values += values;
+    EXPECT_EQ(6U, values.Size());
+    EXPECT_EQ(2, values[5]);
+    values.Clear();
+    EXPECT_TRUE(StoredInline(values));
+
+    {
+        container::SmallVector<Tracked, 2> tracked{};
+        for (int i{}; i < 10; ++i) {
+            EXPECT_TRUE(tracked.EmplaceBack(i));
+        }
+        EXPECT_EQ(10, Tracked::instances);
+        EXPECT_EQ(9, tracked[9].value);
+        EXPECT_TRUE(tracked.Resize(2));
+        EXPECT_TRUE(tracked.ShrinkToFit());
+        EXPECT_EQ(2, Tracked::instances);
+        container::SmallVector<Tracked, 2> moved_tracked{};
+        moved_tracked = static_cast<container::SmallVector<Tracked, 2>&&>(tracked);
+        EXPECT_EQ(1, moved_tracked[1].value);
+        EXPECT_EQ(2, Tracked::instances);
+    }
+    EXPECT_EQ(0, Tracked::instances);
+}
+
+/********************************************************************************
+ * @brief Small buffer for the training data of the models, see below.
+ ********************************************************************************/
+template <typename T>
+using SmallBuffer = container::SmallVector<T, 8>;
+
+/********************************************************************************
+ * @brief Tests that a model storing its training data in container::SmallVectors 
+ *        yields the same parameters as a model using container::Vectors.
+ ********************************************************************************/
+TEST(LinRegTest, SmallVectorBuffer) { 
+    const container::SmallVector<double, 8> inputs{{0, 1, 2, 3, 4}};
+    const container::SmallVector<double, 8> outputs{{2, 4, 6, 8, 10}};
+    yrgo::LinReg<double, optimizer::Sgd, SmallBuffer> small{};
+    yrgo::LinReg<> reference{{{0, 1, 2, 3, 4}}, {{2, 4, 6, 8, 10}}};
+    EXPECT_TRUE(small.LoadTrainingData(inputs, outputs));
+    EXPECT_TRUE(StoredInline(small.TrainingInputs()));
+    small.Seed(1);
+    reference.Seed(1);
+    small.Train(1000);
+    reference.Train(1000);
+    EXPECT_EQ(reference.Weight(), small.Weight());
+    EXPECT_EQ(reference.Bias(), small.Bias());
+    EXPECT_TRUE(small.Fit());
+    EXPECT_NEAR(2.0, small.Weight(), 1e-9);
+    EXPECT_NEAR(2.0, small.Bias(), 1e-9);
+}
+
+/********************************************************************************
+ * @brief Tests that a container::StaticVector stores its elements within the
+ *        object and rejects operations exceeding its capacity.
+ ********************************************************************************/
+TEST(StaticVectorTest, Capacity) { 
+    container::StaticVector<int, 4> values{{0, 1}};
+    static_assert(container::StaticVector<int, 4>::Capacity() == 4, "");
+    EXPECT_TRUE(StoredInline(values));
+    EXPECT_TRUE(values.PushBack(2));
+    EXPECT_TRUE(values.EmplaceBack(3));
+    EXPECT_TRUE(values.Full());
+    EXPECT_FALSE(values.PushBack(4));
+    EXPECT_FALSE(values.Resize(5));
+    EXPECT_FALSE(values.Reserve(5));
+    values += values;
+    EXPECT_EQ(4U, values.Size());
+    EXPECT_EQ(3, values[3]);
+
+    EXPECT_TRUE(values.PopBack());
+    EXPECT_TRUE(values.Resize(2));
+    container::StaticVector<int, 4> copy{values};
+    values += copy;
+    EXPECT_EQ(4U, values.Size());
+    EXPECT_EQ(1, values[3]);
+
+    {
+        container::StaticVector<Tracked, 3> tracked{};
+        EXPECT_TRUE(tracked.EmplaceBack(1));
+        EXPECT_TRUE(tracked.EmplaceBack(2));
+        container::StaticVector<Tracked, 3> moved{static_cast<container::StaticVector<Tracked, 3>&&>(tracked)};
+        EXPECT_EQ(0U, tracked.Size());
+        EXPECT_EQ(2, moved[1].value);
+        EXPECT_EQ(2, Tracked::instances);
+        EXPECT_TRUE(moved.Resize(3));
+        EXPECT_EQ(3, Tracked::instances);
+    }
+    EXPECT_EQ(0, Tracked::instances);
+}
+
+/********************************************************************************
+ * @brief Static buffer for the training data of the models, see below.
+ ********************************************************************************/
+template <typename T>
+using StaticBuffer = container::StaticVector<T, 8>;
+
+/********************************************************************************
+ * @brief Tests that a Q16.16 model storing its training data in 
+ *        container::StaticVectors yields the same parameters as a model using
+ *        container::Vectors and rejects training data exceeding the capacity.
+ ********************************************************************************/
+TEST(LinRegTest, StaticVectorBuffer) { 
+    container::StaticVector<fixed::Q16_16, 16> inputs{}, outputs{};
+    container::Vector<fixed::Q16_16> vector_inputs{}, vector_outputs{};
+    for (int i{}; i < 5; ++i) {
+        inputs.PushBack(fixed::Q16_16{0.5 * i});
+        outputs.PushBack(fixed::Q16_16{3.0 * i - 5.0});
+        vector_inputs.PushBack(inputs[i]);
+        vector_outputs.PushBack(outputs[i]);
+    }
+    yrgo::LinReg<fixed::Q16_16, optimizer::Sgd, StaticBuffer> model{};
+    yrgo::LinReg<fixed::Q16_16> reference{vector_inputs, vector_outputs};
+    EXPECT_TRUE(model.LoadTrainingData(inputs, outputs));
+    EXPECT_TRUE(StoredInline(model.TrainingInputs()));
+    model.Seed(1);
+    reference.Seed(1);
+    model.Train(100);
+    reference.Train(100);
+    EXPECT_EQ(reference.Weight(), model.Weight());
+    EXPECT_EQ(reference.Bias(), model.Bias());
+
+    while (!inputs.Full()) {
+        inputs.PushBack(fixed::Q16_16{1.0});
+        outputs.PushBack(fixed::Q16_16{1.0});
+    }
+    EXPECT_FALSE(model.LoadTrainingData(inputs, outputs));
+    EXPECT_EQ(0U, model.TrainingInputs().Size());
+}
+
+/********************************************************************************
+ * @brief Tests that the pool allocator hands out contiguous elements, reuses
+ *        freed elements first and grows its chunks geometrically.
+ ********************************************************************************/
+TEST(PoolAllocatorTest, Allocate) { 
+    container::PoolAllocator<double> pool{};
+    double* elements[100]{};
+    for (auto& element : elements) {
+        element = pool.Allocate();
+        ASSERT_NE(nullptr, element);
+    }
+    EXPECT_EQ(elements[0] + 1, elements[1]);
+    EXPECT_EQ(elements[0] + 3, elements[3]);
+    EXPECT_EQ(5U, pool.NumChunks()); /* 4 + 8 + 16 + 32 + 64 >= 100 elements. */
+
+    pool.Free(elements[10]);
+    pool.Free(elements[20]);
+    EXPECT_EQ(elements[20], pool.Allocate());
+    EXPECT_EQ(elements[10], pool.Allocate());
+    pool.Release();
+    EXPECT_EQ(0U, pool.NumChunks());
+    EXPECT_NE(nullptr, pool.Allocate());
+    EXPECT_EQ(1U, pool.NumChunks());
+}
+
+/********************************************************************************
+ * @brief Pushes, inserts and removes values in a list with specified allocator
+ *        policy and verifies the content.
+ ********************************************************************************/
+template <template <typename> class Allocator>
+void TestList(void) {
+    container::List<int, Allocator> list{};
+    for (int i{}; i < 100; ++i) {
+        EXPECT_TRUE(list.PushBack(i));
+    }
+    EXPECT_TRUE(list.PushFront(-1));
+    list.PopBack();
+    list.PopFront();
+    auto position{list.begin()};
+    position += 50;
+    EXPECT_TRUE(list.Remove(position));
+    position = list.begin();
+    position += 50;
+    EXPECT_TRUE(list.Insert(position, 50));
+    EXPECT_EQ(99U, list.Size());
+
+    int expected{};
+    for (const auto& value : list) {
+        EXPECT_EQ(expected++, value);
+    }
+    container::List<int, Allocator> copy{list};
+    EXPECT_EQ(99U, copy.Size());
+    EXPECT_EQ(98, *copy.last());
+    list.Clear();
+    EXPECT_TRUE(list.Empty());
+    EXPECT_TRUE(list.PushBack(1));
+    EXPECT_EQ(1, *list.begin());
+}
+
+/********************************************************************************
+ * @brief Tests lists with both allocator policies, and that the pool
+ *        allocator destroys non-trivial elements when the list is cleared.
+ ********************************************************************************/
+TEST(ListTest, Allocators) { 
+    TestList<container::PoolAllocator>();
+    TestList<container::HeapAllocator>();
+    {
+        container::List<Tracked> list{};
+        for (int i{}; i < 10; ++i) {
+            EXPECT_TRUE(list.PushBack(Tracked{i}));
+        }
+        EXPECT_EQ(10, Tracked::instances);
+        list.PopBack();
+        EXPECT_EQ(9, Tracked::instances);
+    }
+    EXPECT_EQ(0, Tracked::instances);
+}
+
 /********************************************************************************
  * @brief Initializes Google Test framework and runs all tests.
  * 
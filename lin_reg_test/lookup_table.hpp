@@ -0,0 +1,155 @@
+/********************************************************************************
+ * @brief Implementation of lookup tables for evaluating linear regression
+ *        models with integer instructions only.
+ ********************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+namespace yrgo {
+
+/********************************************************************************
+ * @brief Class for implementation of lookup tables, which map raw integer input
+ *        codes (for instance 10-bit ADC readings) to rounded model predictions.
+ *        The input range is split into 2^segment_bits uniform segments. The
+ *        prediction at each segment boundary is stored as a fixed-point number
+ *        and values between the boundaries are linearly interpolated, which
+ *        is exact for linear models. The stored predictions are rounded to
+ *        1 / 2^frac_bits, hence inputs whose prediction lies within this 
+ *        margin of a rounding boundary may be rounded in the other direction.
+ *
+ *        The table must be regenerated whenever the model is retrained or new
+ *        parameters are loaded.
+ *
+ * @tparam input_bits
+ *         The number of bits of the input codes (default = 10).
+ * @tparam segment_bits
+ *         The number of bits used to select the segment (default = 6, i.e. 64
+ *         segments stored in 65 entries).
+ * @tparam frac_bits
+ *         The number of fractional bits of the stored predictions (default = 4,
+ *         i.e. predictions within [-2048, 2048) can be stored).
+ ********************************************************************************/
+template <uint8_t input_bits = 10, uint8_t segment_bits = 6, uint8_t frac_bits = 4>
+class LookupTable {
+    static_assert(segment_bits <= input_bits, "Number of segments cannot exceed number of inputs!");
+    static_assert(frac_bits < 16, "Invalid number of fractional bits!");
+    static_assert(input_bits - segment_bits + frac_bits > 0, "Rounding requires at least one fractional bit!");
+  public:
+    static constexpr uint16_t kNumSegments{1U << segment_bits};         /* Number of segments. */
+    static constexpr uint16_t kMaxCode{(1UL << input_bits) - 1};        /* Maximum input code. */
+    static constexpr uint8_t kOffsetBits{input_bits - segment_bits};    /* Bits within segment. */
+
+    /********************************************************************************
+     * @brief Default constructor, creates table predicting 0 for all inputs.
+     ********************************************************************************/
+    constexpr LookupTable(void) = default;
+
+    /********************************************************************************
+     * @brief Creates table for a linear model with specified parameters. If the
+     *        parameters are constant expressions, the table is generated at
+     *        compile time.
+     *
+     * @param weight
+     *        The weight (k-value) of the model.
+     * @param bias
+     *        The bias (m-value) of the model.
+     * @param input_scale
+     *        The model input corresponding to one input code, for instance
+     *        5.0 / 1023 to convert ADC codes to voltages.
+     ********************************************************************************/
+    constexpr LookupTable(const double weight, const double bias, const double input_scale) {
+        Generate(weight, bias, input_scale);
+    }
+
+    /********************************************************************************
+     * @brief Generates the table from referenced linear model.
+     *
+     * @param model
+     *        Reference to the model, which provides the parameters via the
+     *        Weight and Bias methods.
+     * @param input_scale
+     *        The model input corresponding to one input code.
+     ********************************************************************************/
+    template <typename Model>
+    void Generate(const Model& model, const double input_scale) {
+        Generate(static_cast<double>(model.Weight()), static_cast<double>(model.Bias()), input_scale);
+    }
+
+    /********************************************************************************
+     * @brief Generates the table by sampling the predictions of referenced model
+     *        at the segment boundaries, for instance a piecewise-linear model.
+     *        Non-linear models are linearly interpolated between the boundaries.
+     *
+     * @param model
+     *        Reference to the model, which provides the Predict method.
+     * @param input_scale
+     *        The model input corresponding to one input code.
+     ********************************************************************************/
+    template <typename Model>
+    void Sample(const Model& model, const double input_scale) {
+        for (uint16_t i{}; i <= kNumSegments; ++i) {
+            const auto input{input_scale * (static_cast<uint32_t>(i) << kOffsetBits)};
+            const auto prediction{static_cast<double>(model.Predict(input)) * (1U << frac_bits)};
+            data_[i] = Round(prediction);
+        }
+    }
+
+    /********************************************************************************
+     * @brief Generates the table for a linear model with specified parameters.
+     *
+     * @param weight
+     *        The weight (k-value) of the model.
+     * @param bias
+     *        The bias (m-value) of the model.
+     * @param input_scale
+     *        The model input corresponding to one input code.
+     ********************************************************************************/
+    constexpr void Generate(const double weight, const double bias, const double input_scale) {
+        for (uint16_t i{}; i <= kNumSegments; ++i) {
+            const auto prediction{(weight * input_scale * (static_cast<uint32_t>(i) << kOffsetBits) + bias) *
+                                  (1U << frac_bits)};
+            data_[i] = Round(prediction);
+        }
+    }
+
+    /********************************************************************************
+     * @brief Returns the prediction for specified input code, rounded to the
+     *        nearest integer. Codes above the maximum code are clamped.
+     *
+     * @param code
+     *        The input code to predict with.
+     * @return
+     *        The rounded prediction.
+     ********************************************************************************/
+    constexpr int16_t Lookup(uint16_t code) const {
+        if (code > kMaxCode) code = kMaxCode;
+        const auto segment{code >> kOffsetBits};
+        const auto offset{static_cast<int32_t>(code & ((1U << kOffsetBits) - 1))};
+        const int32_t start{data_[segment]};
+        const auto value{static_cast<int32_t>(start * (1L << kOffsetBits) + 
+                                              (data_[segment + 1] - start) * offset)};
+        return static_cast<int16_t>((value + (1L << (kOffsetBits + frac_bits - 1))) >>
+                                    (kOffsetBits + frac_bits));
+    }
+
+  private:
+    int16_t data_[kNumSegments + 1]{}; /* Predictions at segment boundaries. */
+
+    /********************************************************************************
+     * @brief Rounds specified scaled prediction to the nearest entry value. Values
+     *        outside the 16-bit range are saturated instead of wrapping around.
+     *
+     * @param prediction
+     *        The prediction multiplied by 2^frac_bits.
+     * @return
+     *        The rounded and saturated entry value.
+     ********************************************************************************/
+    static constexpr int16_t Round(const double prediction) {
+        if (prediction >= INT16_MAX) return INT16_MAX;
+        if (prediction <= INT16_MIN) return INT16_MIN;
+        return static_cast<int16_t>(prediction < 0 ? prediction - 0.5 : prediction + 0.5);
+    }
+};
+
+} /* namespace yrgo */
@@ -0,0 +1,353 @@
+/********************************************************************************
+ * @brief Library for implementing multivariate linear regression models in C++,
+ *        i.e. models predicting with several input features.
+ ********************************************************************************/
+#pragma once
+
+#include "vector.hpp"
+#include "simd.hpp"
+#include "random.hpp"
+#include "linalg.hpp"
+#include "training.hpp"
+#include <stdlib.h>
+
+namespace yrgo {
+namespace detail {
+
+/********************************************************************************
+ * @brief Class for implementing buffers of a size known at compile time, which
+ *        are stored inside the owning object (no heap allocation).
+ *
+ * @tparam T
+ *         The type of the stored values.
+ * @tparam size
+ *         The number of stored values. The specialization for size 0 allocates
+ *         the values on the heap at runtime instead.
+ ********************************************************************************/
+template <typename T, size_t size>
+class Buffer {
+  public:
+    bool Resize(const size_t new_size) { return new_size == size; }
+    T* Data(void) { return data_; }
+    const T* Data(void) const { return data_; }
+    size_t Size(void) const { return size; }
+
+  private:
+    T data_[size]{}; /* Stored values. */
+};
+
+/********************************************************************************
+ * @brief Class for implementing buffers of a size known at runtime, where the
+ *        values are allocated on the heap and initialized to zero.
+ ********************************************************************************/
+template <typename T>
+class Buffer<T, 0> {
+  public:
+    bool Resize(const size_t new_size) {
+        if (!data_.Resize(new_size)) return false;
+        for (auto& value : data_) {
+            value = T{};
+        }
+        return true;
+    }
+    T* Data(void) { return data_.Data(); }
+    const T* Data(void) const { return data_.Data(); }
+    size_t Size(void) const { return data_.Size(); }
+
+  private:
+    container::Vector<T> data_{}; /* Stored values. */
+};
+
+/********************************************************************************
+ * @brief Returns specified number rounded up to a whole number of SIMD vectors.
+ ********************************************************************************/
+constexpr size_t PadToLanes(const size_t size) {
+    return (size + simd::kLanes - 1) / simd::kLanes * simd::kLanes;
+}
+
+} /* namespace detail */
+
+/********************************************************************************
+ * @brief Class for implementing multivariate linear regression models, where
+ *        the prediction is calculated as
+ *
+ *                          y_pred = k0 * x0 + k1 * x1 + ... + m,
+ *
+ *        where x0, x1, ... are the input features, k0, k1, ... are the weights
+ *        and m is the bias.
+ *
+ *        The training data is stored as a contiguous row-major matrix with one
+ *        row per training set. Each row is padded with zeros to a whole number
+ *        of SIMD vectors, so the dot products are calculated with SIMD
+ *        instructions without scalar remainder loops. The rows are padded but
+ *        not aligned, so the SIMD kernels use unaligned loads.
+ *
+ * @tparam N
+ *         The number of input features. If 0, the number of features is
+ *         specified at runtime, see DynLinReg. Else the weights are stored
+ *         inside the model.
+ * @tparam T
+ *         The scalar type used for training and prediction (default = double).
+ ********************************************************************************/
+template <size_t N, typename T = double>
+class MultiLinReg {
+  public:
+
+    /********************************************************************************
+     * @brief Creates empty regression model with specified number of features.
+     *
+     * @param num_features
+     *        The number of input features, which is ignored unless the number
+     *        of features is specified at runtime (default = N).
+     ********************************************************************************/
+    explicit MultiLinReg(const size_t num_features = N)
+        : num_features_{N > 0 ? N : num_features}
+        , stride_{detail::PadToLanes(num_features_)} {
+        weights_.Resize(stride_);
+    }
+
+    /********************************************************************************
+     * @brief Returns the number of input features of the model.
+     ********************************************************************************/
+    size_t NumFeatures(void) const { return num_features_; }
+
+    /********************************************************************************
+     * @brief Makes a prediction with specified input features.
+     *
+     * @param input
+     *        Pointer to the input features (x0, x1, ...) to predict with.
+     * @return
+     *        The predicted value (y_pred).
+     ********************************************************************************/
+    T Predict(const T* input) const {
+        return simd::Dot(weights_.Data(), input, num_features_) + bias_;
+    }
+
+    /********************************************************************************
+     * @brief Loads training data, where the input features are stored in
+     *        row-major order with one row of NumFeatures values per training set.
+     *
+     * @param inputs
+     *        Pointer to the input features (x) of all training sets.
+     * @param outputs
+     *        Pointer to the reference values (y_ref) of all training sets.
+     * @param num_sets
+     *        The number of training sets.
+     * @return
+     *        True if the training data was loaded, false if memory allocation failed.
+     ********************************************************************************/
+    bool LoadTrainingData(const T* inputs, const T* outputs, const size_t num_sets);
+
+    /********************************************************************************
+     * @brief Loads training data from referenced container::Vectors, where the
+     *        input features are stored in row-major order with one row of
+     *        NumFeatures values per training set. Superfluous values are ignored.
+     *
+     * @param inputs
+     *        Reference to container::Vector containing the input features (x).
+     * @param outputs
+     *        Reference to container::Vector containing reference data (y_ref).
+     * @return
+     *        True if the training data was loaded, false if memory allocation failed.
+     ********************************************************************************/
+    bool LoadTrainingData(const container::Vector<T>& inputs, const container::Vector<T>& outputs) {
+        const auto input_sets{num_features_ > 0 ? inputs.Size() / num_features_ : 0};
+        return LoadTrainingData(inputs.Data(), outputs.Data(),
+                                input_sets < outputs.Size() ? input_sets : outputs.Size());
+    }
+
+    /********************************************************************************
+     * @brief Trains the model with stochastic gradient descent, where the
+     *        training sets are visited in a new random order each epoch.
+     *
+     * @param num_epochs
+     *        The number of epochs (turns) to train.
+     * @param learning_rate
+     *        The learning rate (default = 0.01). If set to 0, the rate
+     *        1 / (max(|x|^2) + 1) is derived from the input features.
+     * @param tolerance
+     *        The training is stopped early when the summed change of the weights
+     *        and bias during an epoch doesn't exceed the tolerance (default = 0).
+     * @param patience
+     *        The number of consecutive epochs within the tolerance required to stop
+     *        the training early (default = 1).
+     * @return
+     *        The number of epochs actually trained.
+     ********************************************************************************/
+    size_t Train(const size_t num_epochs, const T learning_rate = T{0.01},
+                 const T tolerance = T{}, const size_t patience = 1);
+
+    /********************************************************************************
+     * @brief Fits the model to the stored training data by solving the normal
+     *        equations of the centered features via Cholesky decomposition. The
+     *        decomposition requires N^3 / 6 multiplications, so it's suitable
+     *        for a small number of features.
+     *
+     * @return
+     *        True if the model was fitted, false if the features of the stored
+     *        training sets are linearly dependent (the model is unchanged).
+     ********************************************************************************/
+    bool Fit(void);
+
+    /********************************************************************************
+     * @brief Returns the weight of specified feature.
+     ********************************************************************************/
+    T Weight(const size_t feature) const { return weights_.Data()[feature]; }
+
+    /********************************************************************************
+     * @brief Returns the bias (m-value) of the model.
+     ********************************************************************************/
+    T Bias(void) const { return bias_; }
+
+    /********************************************************************************
+     * @brief Sets the parameters of the model.
+     *
+     * @param weights
+     *        Pointer to the new weights (k0, k1, ...), one per feature.
+     * @param bias
+     *        The new bias (m-value) of the model.
+     ********************************************************************************/
+    void SetParameters(const T* weights, const T bias) {
+        for (size_t i{}; i < num_features_; ++i) {
+            weights_.Data()[i] = weights[i];
+        }
+        bias_ = bias;
+    }
+
+    /********************************************************************************
+     * @brief Seeds the random generator used to vary the training order.
+     ********************************************************************************/
+    void Seed(const uint32_t seed) { rng_.Seed(seed); }
+
+  private:
+    size_t num_features_;                    /* Number of input features. */
+    size_t stride_;                          /* Number of values per (padded) row. */
+    container::Vector<T> train_in_{};        /* Padded input features, row-major. */
+    container::Vector<T> train_out_{};       /* Reference values (y_ref). */
+    detail::Buffer<T, detail::PadToLanes(N)> weights_{}; /* k-values, zero padded. */
+    T bias_{};                               /* m-value. */
+    T auto_rate_{1};                         /* Derived learning rate. */
+    random::Xorshift32 rng_{};               /* Generator for the training order. */
+};
+
+/********************************************************************************
+ * @brief Multivariate linear regression model, where the number of features is
+ *        specified at runtime, e.g. DynLinReg<> model{num_features}.
+ ********************************************************************************/
+template <typename T = double>
+using DynLinReg = MultiLinReg<0, T>;
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Each row of input features is copied into the padded matrix, where
+ *           the padding is zero, so that the padding never contributes to
+ *           the dot products.
+ *        2. The learning rate 1 / (max(|x|^2) + 1) is derived, which ensures
+ *           that a single update never overshoots.
+ ********************************************************************************/
+template <size_t N, typename T>
+bool MultiLinReg<N, T>::LoadTrainingData(const T* inputs, const T* outputs, const size_t num_sets) {
+    if (!train_in_.Resize(num_sets * stride_) || !train_out_.Resize(num_sets)) return false;
+    double max_norm{};
+    for (size_t i{}; i < num_sets; ++i) {
+        auto row{train_in_.Data() + i * stride_};
+        double norm{};
+        for (size_t j{}; j < stride_; ++j) {
+            row[j] = j < num_features_ ? inputs[i * num_features_ + j] : T{};
+            norm += static_cast<double>(row[j]) * static_cast<double>(row[j]);
+        }
+        if (norm > max_norm) max_norm = norm;
+        train_out_[i] = outputs[i];
+    }
+    auto_rate_ = static_cast<T>(1.0 / (max_norm + 1.0));
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Each epoch, the training sets are visited in the order of a random
+ *           affine permutation, so no index vector is stored.
+ *        2. For each training set, the error is calculated with a SIMD dot
+ *           product and the weights are adjusted as k = k + error * LR * x
+ *           with a SIMD multiply-add over the padded row.
+ *        3. Each epoch returns the summed change of the parameters to the
+ *           shared training loop, which stops the training early once the
+ *           change has been within the tolerance for patience epochs.
+ ********************************************************************************/
+template <size_t N, typename T>
+size_t MultiLinReg<N, T>::Train(const size_t num_epochs, const T learning_rate,
+                                const T tolerance, const size_t patience) {
+    const auto rate{learning_rate != T{} ? learning_rate : auto_rate_};
+    const auto num_sets{train_out_.Size()};
+    detail::Buffer<T, detail::PadToLanes(N)> previous{};
+    if (!previous.Resize(stride_)) return 0;
+
+    return detail::TrainEpochs(num_epochs, tolerance, patience, [&](size_t) {
+        for (size_t i{}; i < stride_; ++i) {
+            previous.Data()[i] = weights_.Data()[i];
+        }
+        const auto bias{bias_};
+        random::AffinePermutation order{num_sets, rng_};
+        for (size_t i{}; i < num_sets; ++i) {
+            const auto j{order.Next()};
+            const auto row{train_in_.Data() + j * stride_};
+            const T error{train_out_[j] - (simd::Dot(weights_.Data(), row, stride_) + bias_)};
+            const T step{error * rate};
+            bias_ += step;
+            simd::AddScaled(row, weights_.Data(), stride_, step);
+        }
+        return detail::Distance(bias_, bias) +
+               detail::Distance(weights_.Data(), previous.Data(), num_features_);
+    });
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The means of the features and reference values are calculated.
+ *        2. The covariance matrix A = sum((x - mean(x)) * (x - mean(x))^T) and
+ *           the vector b = sum((x - mean(x)) * (y - mean(y))) are accumulated
+ *           with double precision. Centering the values improves the condition
+ *           of A and removes the bias from the system.
+ *        3. A * k = b is solved via Cholesky decomposition, after which the
+ *           bias is calculated as m = mean(y) - k * mean(x).
+ ********************************************************************************/
+template <size_t N, typename T>
+bool MultiLinReg<N, T>::Fit(void) {
+    const auto n{num_features_};
+    const auto num_sets{train_out_.Size()};
+    if (num_sets == 0) return false;
+    detail::Buffer<double, N * N> a{};
+    detail::Buffer<double, N> b{}, mean{};
+    if (!a.Resize(n * n) || !b.Resize(n) || !mean.Resize(n)) return false;
+
+    double mean_y{};
+    for (size_t i{}; i < num_sets; ++i) {
+        const auto row{train_in_.Data() + i * stride_};
+        for (size_t j{}; j < n; ++j) {
+            mean.Data()[j] += static_cast<double>(row[j]) / num_sets;
+        }
+        mean_y += static_cast<double>(train_out_[i]) / num_sets;
+    }
+    for (size_t i{}; i < num_sets; ++i) {
+        const auto row{train_in_.Data() + i * stride_};
+        const auto dy{static_cast<double>(train_out_[i]) - mean_y};
+        for (size_t j{}; j < n; ++j) {
+            const auto dx{static_cast<double>(row[j]) - mean.Data()[j]};
+            for (size_t k{}; k <= j; ++k) {
+                a.Data()[j * n + k] += dx * (static_cast<double>(row[k]) - mean.Data()[k]);
+            }
+            b.Data()[j] += dx * dy;
+        }
+    }
+    if (!linalg::CholeskySolve(a.Data(), b.Data(), n)) return false;
+
+    double bias{mean_y};
+    for (size_t j{}; j < n; ++j) {
+        weights_.Data()[j] = static_cast<T>(b.Data()[j]);
+        bias -= b.Data()[j] * mean.Data()[j];
+    }
+    bias_ = static_cast<T>(bias);
+    return true;
+}
+
+} /* namespace yrgo */
@@ -0,0 +1,136 @@
+/********************************************************************************
+ * @brief Library for implementing online linear regression models in C++.
+ ********************************************************************************/
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace yrgo {
+
+/********************************************************************************
+ * @brief Class for implementing online linear regression models. The model is
+ *        trained one sample at a time and only stores the sufficient statistics
+ *        of the samples (means and deviation sums), so no training data needs
+ *        to be buffered. The least-squares weight and bias are available at
+ *        any time.
+ ********************************************************************************/
+class OnlineLinReg {
+  public:
+
+    /********************************************************************************
+     * @brief Default constructor, creates empty regression model.
+     ********************************************************************************/
+    constexpr OnlineLinReg(void) = default;
+
+    /********************************************************************************
+     * @brief Makes a prediction with the specified input value.
+     *        The prediction is calculated as
+     *
+     *                                y_pred = kx + m,
+     *
+     * where x is the specified input value, k is the weight and m is the bias.
+     *
+     * @param input
+     *        The input value (x) to predict with.
+     * @return
+     *        The predicted value (y_pred).
+     ********************************************************************************/
+    constexpr double Predict(const double input) const {
+        return Weight() * input + Bias();
+    }
+
+    /********************************************************************************
+     * @brief Updates the model with a new sample. The means and deviation sums are
+     *        updated around the running means (Welford's method), which avoids
+     *        cancellation errors for large input values.
+     *
+     * @param input
+     *        The input value of the sample (x).
+     * @param reference
+     *        The reference value of the sample (y_ref).
+     ********************************************************************************/
+    constexpr void Observe(const double input, const double reference) {
+        const auto dx{input - mean_x_}; /* Deviation from previous mean. */
+        count_++;
+        mean_x_ += dx / count_;
+        mean_y_ += (reference - mean_y_) / count_;
+        sxx_ += dx * (input - mean_x_);
+        sxy_ += dx * (reference - mean_y_);
+    }
+
+    /********************************************************************************
+     * @brief Merges the samples observed by referenced model into this model, as
+     *        if all samples had been observed by this model. This enables models
+     *        trained on separate parts of a dataset to be combined (Chan's method).
+     *
+     * @param other
+     *        Reference to the model whose samples are merged.
+     ********************************************************************************/
+    constexpr void Merge(const OnlineLinReg& other) {
+        if (other.count_ == 0) return;
+        if (count_ == 0) {
+            *this = other;
+            return;
+        }
+        const double count{static_cast<double>(count_ + other.count_)};
+        const double factor{static_cast<double>(count_) * other.count_ / count};
+        const auto dx{other.mean_x_ - mean_x_};
+        const auto dy{other.mean_y_ - mean_y_};
+        mean_x_ += dx * other.count_ / count;
+        mean_y_ += dy * other.count_ / count;
+        sxx_ += other.sxx_ + dx * dx * factor;
+        sxy_ += other.sxy_ + dx * dy * factor;
+        count_ += other.count_;
+    }
+
+    /********************************************************************************
+     * @brief Resets the model, i.e. all observed samples are discarded.
+     ********************************************************************************/
+    constexpr void Reset(void) { *this = OnlineLinReg{}; }
+
+    /********************************************************************************
+     * @brief Returns the number of observed samples.
+     *
+     * @return
+     *        The number of samples observed since the model was created or reset.
+     ********************************************************************************/
+    constexpr uint32_t Count(void) const { return count_; }
+
+    /********************************************************************************
+     * @brief Indicates if the weight of the model can be determined, which
+     *        requires at least two samples with different input values.
+     *
+     * @return
+     *        True if the model is fitted, else false.
+     ********************************************************************************/
+    constexpr bool Fitted(void) const { return sxx_ > 0; }
+
+    /********************************************************************************
+     * @brief Returns the least-squares weight of the observed samples, calculated
+     *        as k = Sxy / Sxx. The weight is 0 until the model is fitted.
+     *
+     * @return
+     *        The weight (k-value) of the model.
+     ********************************************************************************/
+    constexpr double Weight(void) const { return Fitted() ? sxy_ / sxx_ : 0; }
+
+    /********************************************************************************
+     * @brief Returns the least-squares bias of the observed samples, calculated
+     *        as m = mean(y) - k * mean(x).
+     *
+     * @return
+     *        The bias (m-value) of the model.
+     ********************************************************************************/
+    constexpr double Bias(void) const { return mean_y_ - Weight() * mean_x_; }
+
+  private:
+    uint32_t count_{}; /* Number of observed samples, 32 bits so it doesn't wrap
+                        * on AVR, where size_t is 16 bits. */
+    double mean_x_{};  /* Mean of observed input values (x). */
+    double mean_y_{};  /* Mean of observed reference values (y_ref). */
+    double sxx_{};     /* Sum of squared input deviations from the mean. */
+    double sxy_{};     /* Sum of input and reference deviation products. */
+};
+
+} /* namespace yrgo */
@@ -0,0 +1,270 @@
+/********************************************************************************
+ * @brief Multithreaded training of linear regression models on large datasets.
+ *        Only intended for host builds, since std::thread is required.
+ ********************************************************************************/
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "lin_reg.hpp"
+#include "piecewise_lin_reg.hpp"
+
+namespace yrgo {
+
+/********************************************************************************
+ * @brief Class for data-parallel training of linear regression models. The
+ *        stored training data of a model is split into one contiguous shard per
+ *        thread. Each thread calculates partial results for its shard, which are
+ *        combined with a pairwise tree reduction in fixed order. The results are
+ *        therefore bit-identical for a given number of threads, regardless of
+ *        the thread scheduling.
+ *
+ *        The worker threads are created once by the constructor and wait for
+ *        work between the steps, so an epoch only costs a wake-up per thread.
+ ********************************************************************************/
+class ParallelTrainer {
+  public:
+
+    /********************************************************************************
+     * @brief Creates trainer using specified number of threads. The calling thread
+     *        is used as one of the threads, the others are started as workers.
+     *
+     * @param num_threads
+     *        The number of threads to train with (default = number of cores).
+     ********************************************************************************/
+    explicit ParallelTrainer(const std::size_t num_threads = std::thread::hardware_concurrency())
+        : num_threads_{num_threads > 0 ? num_threads : 1} {
+        workers_.reserve(num_threads_ - 1);
+        for (std::size_t shard{1}; shard < num_threads_; ++shard) {
+            workers_.emplace_back([this, shard] { Work(shard); });
+        }
+    }
+
+    /********************************************************************************
+     * @brief Deleted copy constructor, since the worker threads are owned by the
+     *        trainer.
+     ********************************************************************************/
+    ParallelTrainer(const ParallelTrainer&) = delete;
+
+    /********************************************************************************
+     * @brief Deleted assignment operator, since the worker threads are owned by
+     *        the trainer.
+     ********************************************************************************/
+    ParallelTrainer& operator=(const ParallelTrainer&) = delete;
+
+    /********************************************************************************
+     * @brief Destructor, stops and joins the worker threads.
+     ********************************************************************************/
+    ~ParallelTrainer(void) {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            stop_ = true;
+        }
+        start_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    /********************************************************************************
+     * @brief Returns the number of threads used for training.
+     *
+     * @return
+     *        The number of threads, including the calling thread.
+     ********************************************************************************/
+    std::size_t NumThreads(void) const { return num_threads_; }
+
+    /********************************************************************************
+     * @brief Fits referenced model to its stored training data with the
+     *        closed-form least-squares solution. Each thread accumulates the
+     *        means and deviation sums of its shard, which are then merged.
+     *        Standardized training data is supported, see LinReg::Fit.
+     *
+     * @param model
+     *        Reference to the model to fit.
+     * @return
+     *        True if the model was fitted, false if the stored training sets don't
+     *        contain at least two different input values (the model is unchanged).
+     ********************************************************************************/
+    bool Fit(LinReg<double>& model) {
+        const auto& inputs{model.TrainingInputs()};
+        const auto& outputs{model.TrainingOutputs()};
+        std::vector<OnlineLinReg> partials(num_threads_);
+        Run([&](const std::size_t shard) {
+            for (auto i{ShardBegin(shard, inputs.Size())}; i < ShardBegin(shard + 1, inputs.Size()); ++i) {
+                partials[shard].Observe(inputs[i], outputs[i]);
+            }
+        });
+        Reduce(partials, [](OnlineLinReg& a, const OnlineLinReg& b) { a.Merge(b); });
+        if (!partials[0].Fitted()) return false;
+        model.SetStandardizedParameters(partials[0].Weight(), partials[0].Bias());
+        return true;
+    }
+
+    /********************************************************************************
+     * @brief Fits the segments of referenced piecewise-linear model in parallel,
+     *        where each thread fits a contiguous range of segments.
+     *
+     * @param model
+     *        Reference to the model to fit.
+     * @return
+     *        True if all segments were fitted, false if any segment doesn't
+     *        contain at least two different input values (that segment is unchanged).
+     ********************************************************************************/
+    template <std::size_t num_segments>
+    bool Fit(PiecewiseLinReg<num_segments>& model) {
+        std::vector<char> fitted(num_threads_, true);
+        Run([&](const std::size_t shard) {
+            for (auto i{ShardBegin(shard, num_segments)}; i < ShardBegin(shard + 1, num_segments); ++i) {
+                if (!model.GetSegment(i).Fit()) fitted[shard] = false;
+            }
+        });
+        for (const auto segments_fitted : fitted) {
+            if (!segments_fitted) return false;
+        }
+        return true;
+    }
+
+    /********************************************************************************
+     * @brief Trains referenced model on its stored training data with full-batch
+     *        gradient descent, which is equivalent to LinReg::Train in batch mode
+     *        with plain gradient descent. Each thread calculates the gradient sums
+     *        of its shard every epoch. Standardized training data is supported.
+     *
+     * @param model
+     *        Reference to the model to train.
+     * @param num_epochs
+     *        The number of epochs (turns) to train.
+     * @param learning_rate
+     *        The learning rate, sets the change rate during errors (default = 0.01).
+     ********************************************************************************/
+    void Train(LinReg<double>& model, const std::size_t num_epochs, const double learning_rate = 0.01) {
+        const auto& inputs{model.TrainingInputs()};
+        const auto& outputs{model.TrainingOutputs()};
+        if (inputs.Empty()) return;
+        std::vector<GradientSums> partials(num_threads_);
+        double weight{}, bias{};
+        model.StandardizedParameters(weight, bias);
+
+        for (std::size_t epoch{}; epoch < num_epochs; ++epoch) {
+            Run([&](const std::size_t shard) {
+                const auto begin{ShardBegin(shard, inputs.Size())};
+                simd::ErrorSums(inputs.Data() + begin, outputs.Data() + begin,
+                                ShardBegin(shard + 1, inputs.Size()) - begin, weight, bias,
+                                partials[shard].error_sum, partials[shard].error_input_sum);
+            });
+            Reduce(partials, [](GradientSums& a, const GradientSums& b) {
+                a.error_sum += b.error_sum;
+                a.error_input_sum += b.error_input_sum;
+            });
+            const auto rate{learning_rate / inputs.Size()};
+            bias += partials[0].error_sum * rate;
+            weight += partials[0].error_input_sum * rate;
+        }
+        model.SetStandardizedParameters(weight, bias);
+    }
+
+  private:
+
+    /********************************************************************************
+     * @brief Partial gradient sums of a shard. Each entry is written by its own
+     *        thread, so it's aligned to a cache line to prevent false sharing.
+     ********************************************************************************/
+    struct alignas(64) GradientSums {
+        double error_sum{};       /* Sum of errors. */
+        double error_input_sum{}; /* Sum of errors multiplied by the input values. */
+    };
+
+    std::size_t num_threads_;                    /* Number of threads (and shards). */
+    std::vector<std::thread> workers_{};         /* Workers running shard 1 and up. */
+    std::mutex mutex_{};                         /* Protects the members below. */
+    std::condition_variable start_{};            /* Signals a new step or stop. */
+    std::condition_variable done_{};             /* Signals that all workers are done. */
+    void (*invoke_)(const void*, std::size_t){}; /* Calls the task of the step. */
+    const void* task_{};                         /* Task of the current step. */
+    std::size_t step_{};                         /* Number of started steps. */
+    std::size_t pending_{};                      /* Workers still running the step. */
+    bool stop_{false};                           /* Indicates if the workers shall stop. */
+
+    /********************************************************************************
+     * @brief Returns the index of the first training set of specified shard.
+     ********************************************************************************/
+    std::size_t ShardBegin(const std::size_t shard, const std::size_t num_sets) const {
+        return num_sets * shard / num_threads_;
+    }
+
+    /********************************************************************************
+     * @brief Runs specified task for every shard in parallel and waits until all
+     *        shards are finished. Shard 0 is run by the calling thread, while
+     *        the other shards are run by the waiting workers.
+     *
+     * @param task
+     *        The task to run, which takes the shard index as argument.
+     ********************************************************************************/
+    template <typename Task>
+    void Run(const Task& task) {
+        if (workers_.empty()) {
+            task(0);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            invoke_ = [](const void* task, const std::size_t shard) {
+                (*static_cast<const Task*>(task))(shard);
+            };
+            task_ = &task;
+            pending_ = workers_.size();
+            ++step_;
+        }
+        start_.notify_all();
+        task(0);
+        std::unique_lock<std::mutex> lock{mutex_};
+        done_.wait(lock, [this] { return pending_ == 0; });
+    }
+
+    /********************************************************************************
+     * @brief Runs specified shard of each step until the trainer is destroyed,
+     *        which is the routine of the worker threads.
+     *
+     * @param shard
+     *        The shard run by the worker.
+     ********************************************************************************/
+    void Work(const std::size_t shard) {
+        std::size_t step{};
+        std::unique_lock<std::mutex> lock{mutex_};
+        while (true) {
+            start_.wait(lock, [this, step] { return stop_ || step_ != step; });
+            if (stop_) return;
+            step = step_;
+            const auto invoke{invoke_};
+            const auto task{task_};
+            lock.unlock();
+            invoke(task, shard);
+            lock.lock();
+            if (--pending_ == 0) done_.notify_one();
+        }
+    }
+
+    /********************************************************************************
+     * @brief Combines partial results with a pairwise tree reduction in fixed
+     *        order, i.e. (0, 1), (2, 3), ... followed by (0, 2), (4, 6) etc.
+     *        The combined result is stored in the first element.
+     *
+     * @param partials
+     *        Reference to the partial results, one per shard.
+     * @param combine
+     *        Function combining the second argument into the first.
+     ********************************************************************************/
+    template <typename Partial, typename Combine>
+    static void Reduce(std::vector<Partial>& partials, Combine combine) {
+        for (std::size_t stride{1}; stride < partials.size(); stride *= 2) {
+            for (std::size_t i{}; i + stride < partials.size(); i += 2 * stride) {
+                combine(partials[i], partials[i + stride]);
+            }
+        }
+    }
+};
+
+} /* namespace yrgo */
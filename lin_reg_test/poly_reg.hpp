@@ -0,0 +1,269 @@
+/********************************************************************************
+ * @brief Library for implementing polynomial regression models in C++, i.e.
+ *        models for non-linear responses such as thermistor curves.
+ ********************************************************************************/
+#pragma once
+
+#include "vector.hpp"
+#include "fixed_point.hpp"
+#include "random.hpp"
+#include "linalg.hpp"
+#include "training.hpp"
+#include <stdlib.h>
+
+namespace yrgo {
+
+/********************************************************************************
+ * @brief Class for implementing polynomial regression models, where the
+ *        prediction is calculated as
+ *
+ *                     y_pred = c0 + c1 * t + c2 * t^2 + ... + cd * t^d,
+ *
+ *        where t = (x - center) * scale maps the input range of the training
+ *        data onto [-1, 1]. Fitting on the scaled input keeps the normal
+ *        equations well conditioned and the coefficients within the range of
+ *        fixed-point types, even for large inputs such as ADC codes.
+ *
+ *        The polynomial is evaluated with Horner's scheme, i.e. d multiply-adds
+ *        and no powers. With fixed-point types, each multiply-add is rounded
+ *        and saturated once, so the prediction only requires integer instructions.
+ *
+ * @tparam degree
+ *         The degree d of the polynomial, e.g. 3 for a cubic model.
+ * @tparam T
+ *         The scalar type used for training and prediction (default = double).
+ *         Fitting is always performed with double precision.
+ ********************************************************************************/
+template <size_t degree, typename T = double>
+class PolyReg {
+  public:
+    static constexpr size_t kNumCoefficients{degree + 1}; /* Number of coefficients. */
+
+    /********************************************************************************
+     * @brief Default constructor, creates empty regression model.
+     ********************************************************************************/
+    PolyReg(void) = default;
+
+    /********************************************************************************
+     * @brief Creates regression model and loads specified training data.
+     *
+     * @param train_in
+     *        Reference to container::Vector containing input data (x).
+     * @param train_out
+     *        Reference to container::Vector containing reference data (y_ref).
+     ********************************************************************************/
+    PolyReg(const container::Vector<T>& train_in, const container::Vector<T>& train_out) {
+        LoadTrainingData(train_in, train_out);
+    }
+
+    /********************************************************************************
+     * @brief Makes a prediction with specified input using Horner's scheme.
+     *
+     * @param input
+     *        The input (x) to predict with.
+     * @return
+     *        The predicted value (y_pred).
+     ********************************************************************************/
+    T Predict(const T input) const {
+        const T t{(input - center_) * scale_};
+        T result{coefficients_[degree]};
+        for (size_t i{degree}; i-- > 0;) {
+            result = fixed::MulAdd(result, t, coefficients_[i]);
+        }
+        return result;
+    }
+
+    /********************************************************************************
+     * @brief Loads training data from referenced container::Vectors. The input
+     *        range of the training data sets the center and scale of the model.
+     *
+     * @param train_in
+     *        Reference to container::Vector containing input data (x).
+     * @param train_out
+     *        Reference to container::Vector containing reference data (y_ref).
+     * @return
+     *        True if the training data was loaded, false if memory allocation failed.
+     ********************************************************************************/
+    bool LoadTrainingData(const container::Vector<T>& train_in, const container::Vector<T>& train_out);
+
+    /********************************************************************************
+     * @brief Fits the model to the stored training data by solving the normal
+     *        equations via Cholesky decomposition (least squares).
+     *
+     * @return
+     *        True if the model was fitted, false if the training data contains
+     *        fewer than degree + 1 distinct inputs (the model is unchanged).
+     ********************************************************************************/
+    bool Fit(void);
+
+    /********************************************************************************
+     * @brief Trains the model with stochastic gradient descent, where the
+     *        training sets are visited in a new random order each epoch.
+     *
+     * @param num_epochs
+     *        The number of epochs (turns) to train.
+     * @param learning_rate
+     *        The learning rate (default = 0.01). If set to 0, the rate
+     *        1 / (degree + 2) is used, which never overshoots since |t| <= 1.
+     * @param tolerance
+     *        The training is stopped early when the summed change of the
+     *        coefficients during an epoch doesn't exceed the tolerance (default = 0).
+     * @param patience
+     *        The number of consecutive epochs within the tolerance required to stop
+     *        the training early (default = 1).
+     * @return
+     *        The number of epochs actually trained.
+     ********************************************************************************/
+    size_t Train(const size_t num_epochs, const T learning_rate = T{0.01},
+                 const T tolerance = T{}, const size_t patience = 1);
+
+    /********************************************************************************
+     * @brief Returns the coefficient of specified power of the scaled input t.
+     ********************************************************************************/
+    T Coefficient(const size_t power) const { return coefficients_[power]; }
+
+    /********************************************************************************
+     * @brief Returns the center of the input range, which is mapped to t = 0.
+     ********************************************************************************/
+    T Center(void) const { return center_; }
+
+    /********************************************************************************
+     * @brief Returns the scale of the input, i.e. 2 / (max(x) - min(x)).
+     ********************************************************************************/
+    T Scale(void) const { return scale_; }
+
+    /********************************************************************************
+     * @brief Sets the parameters of the model, for instance loaded from EEPROM.
+     *
+     * @param coefficients
+     *        Pointer to the degree + 1 new coefficients (c0, c1, ...).
+     * @param center
+     *        The input mapped to t = 0.
+     * @param scale
+     *        The scale of the input.
+     ********************************************************************************/
+    void SetParameters(const T* coefficients, const T center, const T scale) {
+        for (size_t i{}; i < kNumCoefficients; ++i) {
+            coefficients_[i] = coefficients[i];
+        }
+        center_ = center;
+        scale_ = scale;
+    }
+
+    /********************************************************************************
+     * @brief Seeds the random generator used to vary the training order.
+     ********************************************************************************/
+    void Seed(const uint32_t seed) { rng_.Seed(seed); }
+
+  private:
+    container::Vector<T> train_in_{};     /* Scaled inputs (t). */
+    container::Vector<T> train_out_{};    /* Reference values (y_ref). */
+    T coefficients_[kNumCoefficients]{};  /* Coefficients c0, c1, ... of t. */
+    T center_{};                          /* Input mapped to t = 0. */
+    T scale_{1};                          /* Factor mapping inputs onto [-1, 1]. */
+    random::Xorshift32 rng_{};            /* Generator for the training order. */
+};
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The minimum and maximum input are searched for to calculate the
+ *           center and scale. If all inputs are equal, the scale is set to 1.
+ *        2. The inputs are stored scaled, so that t is only calculated once.
+ ********************************************************************************/
+template <size_t degree, typename T>
+bool PolyReg<degree, T>::LoadTrainingData(const container::Vector<T>& train_in,
+                                          const container::Vector<T>& train_out) {
+    const auto num_sets{train_in.Size() < train_out.Size() ? train_in.Size() : train_out.Size()};
+    if (!train_in_.Resize(num_sets) || !train_out_.Resize(num_sets)) return false;
+    if (num_sets == 0) return true;
+
+    auto min{static_cast<double>(train_in[0])}, max{min};
+    for (size_t i{1}; i < num_sets; ++i) {
+        const auto x{static_cast<double>(train_in[i])};
+        if (x < min) min = x;
+        if (x > max) max = x;
+    }
+    center_ = static_cast<T>((min + max) / 2);
+    scale_ = static_cast<T>(max > min ? 2 / (max - min) : 1.0);
+
+    for (size_t i{}; i < num_sets; ++i) {
+        train_in_[i] = (train_in[i] - center_) * scale_;
+        train_out_[i] = train_out[i];
+    }
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The Gram matrix A = sum(p * p^T) and the vector b = sum(p * y) are
+ *           accumulated with double precision, where p = (1, t, t^2, ...). The
+ *           powers are calculated by repeated multiplication per training set.
+ *        2. A * c = b is solved via Cholesky decomposition. Since |t| <= 1,
+ *           the elements of A are bounded by the number of training sets.
+ ********************************************************************************/
+template <size_t degree, typename T>
+bool PolyReg<degree, T>::Fit(void) {
+    constexpr auto n{kNumCoefficients};
+    double a[n * n]{}, b[n]{};
+
+    for (size_t i{}; i < train_out_.Size(); ++i) {
+        double powers[n]{1.0};
+        for (size_t j{1}; j < n; ++j) {
+            powers[j] = powers[j - 1] * static_cast<double>(train_in_[i]);
+        }
+        for (size_t j{}; j < n; ++j) {
+            for (size_t k{}; k <= j; ++k) {
+                a[j * n + k] += powers[j] * powers[k];
+            }
+            b[j] += powers[j] * static_cast<double>(train_out_[i]);
+        }
+    }
+    if (!linalg::CholeskySolve(a, b, n)) return false;
+
+    for (size_t j{}; j < n; ++j) {
+        coefficients_[j] = static_cast<T>(b[j]);
+    }
+    return true;
+}
+
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. Each epoch, the training sets are visited in the order of a random
+ *           affine permutation, so no index vector is stored.
+ *        2. For each training set, the error is calculated with Horner's scheme
+ *           and each coefficient is adjusted as c = c + error * LR * t^i, where
+ *           the powers of t are accumulated along the coefficients.
+ *        3. Each epoch returns the summed change of the coefficients to the
+ *           shared training loop, which stops the training early once the
+ *           change has been within the tolerance for patience epochs.
+ ********************************************************************************/
+template <size_t degree, typename T>
+size_t PolyReg<degree, T>::Train(const size_t num_epochs, const T learning_rate,
+                                 const T tolerance, const size_t patience) {
+    const T rate{learning_rate != T{} ? learning_rate : static_cast<T>(1.0 / (degree + 2))};
+    const auto num_sets{train_out_.Size()};
+
+    return detail::TrainEpochs(num_epochs, tolerance, patience, [&](size_t) {
+        T previous[kNumCoefficients]{};
+        for (size_t i{}; i < kNumCoefficients; ++i) {
+            previous[i] = coefficients_[i];
+        }
+        random::AffinePermutation order{num_sets, rng_};
+        for (size_t i{}; i < num_sets; ++i) {
+            const auto j{order.Next()};
+            const auto t{train_in_[j]};
+            T prediction{coefficients_[degree]};
+            for (size_t k{degree}; k-- > 0;) {
+                prediction = fixed::MulAdd(prediction, t, coefficients_[k]);
+            }
+            T step{(train_out_[j] - prediction) * rate};
+            for (size_t k{}; k < kNumCoefficients; ++k) {
+                coefficients_[k] += step;
+                step *= t;
+            }
+        }
+        return detail::Distance(coefficients_, previous, kNumCoefficients);
+    });
+}
+
+} /* namespace yrgo */
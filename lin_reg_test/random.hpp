@@ -0,0 +1,171 @@
+/********************************************************************************
+ * @brief Seedable pseudo-random number generation and shuffling without libc
+ *        rand(), which is slow, shares a single global state and only
+ *        produces 15-bit numbers on some targets (e.g. AVR).
+ ********************************************************************************/
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace yrgo {
+namespace random {
+
+/********************************************************************************
+ * @brief Class for implementing a xorshift32 pseudo-random number generator.
+ *        Only 32-bit shifts and XOR operations are used and the state is a single
+ *        32-bit word, which makes it fast on 8-bit devices as well. Each instance
+ *        has its own state, so instances can be used concurrently.
+ ********************************************************************************/
+class Xorshift32 {
+  public:
+    static constexpr uint32_t kDefaultSeed{2463534242UL}; /* Seed used by default. */
+
+    /********************************************************************************
+     * @brief Creates generator with specified seed.
+     *
+     * @param seed
+     *        The seed of the generator (default = kDefaultSeed).
+     ********************************************************************************/
+    constexpr explicit Xorshift32(const uint32_t seed = kDefaultSeed) { Seed(seed); }
+
+    /********************************************************************************
+     * @brief Reseeds the generator, so that the same sequence is generated each
+     *        time the same seed is used. The seed 0 is replaced by kDefaultSeed,
+     *        since the state of the generator must never be 0.
+     *
+     * @param seed
+     *        The new seed of the generator.
+     ********************************************************************************/
+    constexpr void Seed(const uint32_t seed) { state_ = seed != 0 ? seed : kDefaultSeed; }
+
+    /********************************************************************************
+     * @brief Returns the next pseudo-random number of the sequence.
+     *
+     * @return
+     *        Pseudo-random number between 1 and 2^32 - 1.
+     ********************************************************************************/
+    constexpr uint32_t Next(void) {
+        state_ ^= state_ << 13;
+        state_ ^= state_ >> 17;
+        state_ ^= state_ << 5;
+        return state_;
+    }
+
+  private:
+    uint32_t state_{kDefaultSeed}; /* Current state, never 0. */
+};
+
+/********************************************************************************
+ * @brief Returns an unbiased pseudo-random number within [0, bound). The number
+ *        is scaled by multiplication instead of division (Lemire's method), and
+ *        the few products that would make some numbers more likely than others
+ *        are rejected, so a division is only required in rare cases.
+ *
+ * @param generator
+ *        Reference to the generator, which must provide uint32_t Next(void).
+ * @param bound
+ *        The upper bound (exclusive), must be greater than 0.
+ * @return
+ *        Pseudo-random number between 0 and bound - 1.
+ ********************************************************************************/
+template <typename Generator>
+constexpr uint32_t Below(Generator& generator, const uint32_t bound) {
+    auto product{static_cast<uint64_t>(generator.Next()) * bound};
+    if (static_cast<uint32_t>(product) < bound) {
+        const uint32_t threshold{static_cast<uint32_t>(-bound) % bound};
+        while (static_cast<uint32_t>(product) < threshold) {
+            product = static_cast<uint64_t>(generator.Next()) * bound;
+        }
+    }
+    return static_cast<uint32_t>(product >> 32);
+}
+
+/********************************************************************************
+ * @brief Shuffles specified elements with the Fisher-Yates algorithm, where
+ *        each element is swapped with a random element among the ones not yet
+ *        placed. Every permutation is therefore equally likely.
+ *
+ * @param data
+ *        Pointer to the elements to shuffle (at most 2^32 elements).
+ * @param size
+ *        The number of elements.
+ * @param generator
+ *        Reference to the generator, which must provide uint32_t Next(void).
+ ********************************************************************************/
+template <typename T, typename Generator>
+constexpr void Shuffle(T* data, const size_t size, Generator& generator) {
+    for (size_t i{size}; i > 1; --i) {
+        const auto j{Below(generator, static_cast<uint32_t>(i))};
+        const auto temp{data[i - 1]};
+        data[i - 1] = data[j];
+        data[j] = temp;
+    }
+}
+
+/********************************************************************************
+ * @brief Class for generating a pseudo-random permutation of the indexes
+ *        0 - size - 1 on the fly, without storing any array. The indexes are
+ *        generated as (stride * i + offset) mod size, where the stride is coprime
+ *        to the size, so that each index is visited exactly once. Only an
+ *        addition and a comparison are required per index.
+ *
+ *        Only size * phi(size) orders can be generated, which is far fewer than
+ *        the size! orders of a full shuffle, but sufficient to vary the order
+ *        of the training sets between epochs.
+ ********************************************************************************/
+class AffinePermutation {
+  public:
+
+    /********************************************************************************
+     * @brief Creates permutation of specified size with a random stride and offset.
+     *
+     * @param size
+     *        The number of indexes (at most 2^32).
+     * @param generator
+     *        Reference to the generator, which must provide uint32_t Next(void).
+     ********************************************************************************/
+    template <typename Generator>
+    constexpr AffinePermutation(const size_t size, Generator& generator)
+        : size_{size} {
+        if (size_ < 2) return;
+        do {
+            stride_ = Below(generator, static_cast<uint32_t>(size_ - 1)) + 1;
+        } while (Gcd(stride_, size_) != 1);
+        index_ = Below(generator, static_cast<uint32_t>(size_));
+    }
+
+    /********************************************************************************
+     * @brief Returns the next index of the permutation. After size indexes, the
+     *        permutation is repeated.
+     *
+     * @return
+     *        The next index.
+     ********************************************************************************/
+    constexpr size_t Next(void) {
+        const auto index{index_};
+        index_ += stride_;
+        if (index_ >= size_) index_ -= size_;
+        return index;
+    }
+
+  private:
+    size_t size_{};    /* Number of indexes. */
+    size_t stride_{1}; /* Distance between consecutive indexes, coprime to the size. */
+    size_t index_{};   /* Next index. */
+
+    /********************************************************************************
+     * @brief Returns the greatest common divisor of specified numbers.
+     ********************************************************************************/
+    static constexpr size_t Gcd(size_t a, size_t b) {
+        while (b != 0) {
+            const auto remainder{a % b};
+            a = b;
+            b = remainder;
+        }
+        return a;
+    }
+};
+
+} /* namespace random */
+} /* namespace yrgo */
@@ -0,0 +1,351 @@
+/********************************************************************************
+ * @brief Vectorized kernels for evaluating and training linear regression 
+ *        models on many values at once. Explicit SIMD implementations are 
+ *        selected at compile time (AVX-512, AVX2 + FMA or SSE2) for double 
+ *        precision, with a scalar fallback for other types and targets without
+ *        SIMD support (e.g. AVR).
+ ********************************************************************************/
+#pragma once
+
+#include <stdlib.h>
+#include "fixed_point.hpp"
+
+#if defined(__AVX512F__) || defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace yrgo {
+namespace simd {
+
+/********************************************************************************
+ * @brief Number of double-precision values per SIMD vector on the target (1 if
+ *        no SIMD instructions are available). Arrays padded to a multiple of
+ *        this number can be processed without scalar remainder loops.
+ ********************************************************************************/
+#if defined(__AVX512F__)
+constexpr size_t kLanes{8};
+#elif defined(__AVX2__) && defined(__FMA__)
+constexpr size_t kLanes{4};
+#elif defined(__SSE2__)
+constexpr size_t kLanes{2};
+#else
+constexpr size_t kLanes{1};
+#endif
+
+namespace detail {
+
+#if defined(__SSE2__)
+/********************************************************************************
+ * @brief Returns the sum of the elements of specified SIMD vectors.
+ ********************************************************************************/
+inline double Sum(const __m128d values) {
+    return _mm_cvtsd_f64(_mm_add_sd(values, _mm_unpackhi_pd(values, values)));
+}
+#endif
+
+#if defined(__AVX__)
+inline double Sum(const __m256d values) {
+    return Sum(_mm_add_pd(_mm256_castpd256_pd128(values), _mm256_extractf128_pd(values, 1)));
+}
+#endif
+
+#if defined(__AVX512F__)
+inline double Sum(const __m512d values) {
+    double lanes[8];
+    _mm512_storeu_pd(lanes, values);
+    return Sum(_mm256_add_pd(_mm256_loadu_pd(lanes), _mm256_loadu_pd(lanes + 4)));
+}
+#endif
+
+} /* namespace detail */
+
+/********************************************************************************
+ * @brief Calculates output[i] = weight * input[i] + bias for each input value.
+ *
+ * @param input
+ *        Pointer to the input values.
+ * @param output
+ *        Pointer to the output values, which can be the same as the input.
+ * @param size
+ *        The number of values.
+ * @param weight
+ *        The weight to multiply each input value with.
+ * @param bias
+ *        The bias to add to each product.
+ ********************************************************************************/
+template <typename T>
+inline void MulAdd(const T* input, T* output, const size_t size, const T weight, const T bias) {
+    for (size_t i{}; i < size; ++i) {
+        output[i] = fixed::MulAdd(weight, input[i], bias);
+    }
+}
+
+/********************************************************************************
+ * @brief Calculates output[i] = weight * input[i] + bias for each input value
+ *        with double precision, using the widest SIMD instructions available.
+ *
+ * @param input
+ *        Pointer to the input values.
+ * @param output
+ *        Pointer to the output values, which can be the same as the input.
+ * @param size
+ *        The number of values.
+ * @param weight
+ *        The weight to multiply each input value with.
+ * @param bias
+ *        The bias to add to each product.
+ ********************************************************************************/
+inline void MulAdd(const double* input, double* output, const size_t size,
+                   const double weight, const double bias) {
+    size_t i{};
+#if defined(__AVX512F__)
+    const auto w{_mm512_set1_pd(weight)};
+    const auto b{_mm512_set1_pd(bias)};
+    for (; i + 8 <= size; i += 8) {
+        _mm512_storeu_pd(output + i, _mm512_fmadd_pd(w, _mm512_loadu_pd(input + i), b));
+    }
+#elif defined(__AVX2__) && defined(__FMA__)
+    const auto w{_mm256_set1_pd(weight)};
+    const auto b{_mm256_set1_pd(bias)};
+    for (; i + 4 <= size; i += 4) {
+        _mm256_storeu_pd(output + i, _mm256_fmadd_pd(w, _mm256_loadu_pd(input + i), b));
+    }
+#elif defined(__SSE2__)
+    const auto w{_mm_set1_pd(weight)};
+    const auto b{_mm_set1_pd(bias)};
+    for (; i + 2 <= size; i += 2) {
+        _mm_storeu_pd(output + i, _mm_add_pd(_mm_mul_pd(w, _mm_loadu_pd(input + i)), b));
+    }
+#endif
+    for (; i < size; ++i) {
+        output[i] = weight * input[i] + bias;
+    }
+}
+
+/********************************************************************************
+ * @brief Calculates the sums of the prediction errors and the prediction errors
+ *        multiplied by the input values, i.e. the gradient sums of a linear 
+ *        model, where each error is calculated as e = y_ref - (kx + m).
+ *
+ * @param input
+ *        Pointer to the input values (x).
+ * @param reference
+ *        Pointer to the reference values (y_ref).
+ * @param size
+ *        The number of values.
+ * @param weight
+ *        The weight (k-value) of the model.
+ * @param bias
+ *        The bias (m-value) of the model.
+ * @param error_sum
+ *        Reference to variable for storing the sum of all errors.
+ * @param error_input_sum
+ *        Reference to variable for storing the sum of all errors multiplied
+ *        by the corresponding input value.
+ ********************************************************************************/
+template <typename T>
+inline void ErrorSums(const T* input, const T* reference, const size_t size, 
+                      const T weight, const T bias, T& error_sum, T& error_input_sum) {
+    error_sum = {};
+    error_input_sum = {};
+    for (size_t i{}; i < size; ++i) {
+        const T error{reference[i] - fixed::MulAdd(weight, input[i], bias)};
+        error_sum += error;
+        error_input_sum += error * input[i];
+    }
+}
+
+/********************************************************************************
+ * @brief Calculates the sums of the prediction errors and the prediction errors
+ *        multiplied by the input values with double precision, using the widest
+ *        SIMD instructions available. The values are accumulated in one lane
+ *        per SIMD element, so the result is deterministic for a given target.
+ *
+ * @param input
+ *        Pointer to the input values (x).
+ * @param reference
+ *        Pointer to the reference values (y_ref).
+ * @param size
+ *        The number of values.
+ * @param weight
+ *        The weight (k-value) of the model.
+ * @param bias
+ *        The bias (m-value) of the model.
+ * @param error_sum
+ *        Reference to variable for storing the sum of all errors.
+ * @param error_input_sum
+ *        Reference to variable for storing the sum of all errors multiplied
+ *        by the corresponding input value.
+ ********************************************************************************/
+inline void ErrorSums(const double* input, const double* reference, const size_t size, 
+                      const double weight, const double bias, 
+                      double& error_sum, double& error_input_sum) {
+    size_t i{};
+    error_sum = 0;
+    error_input_sum = 0;
+#if defined(__AVX512F__)
+    const auto w{_mm512_set1_pd(weight)};
+    const auto b{_mm512_set1_pd(bias)};
+    auto errors{_mm512_setzero_pd()}, weighted_errors{_mm512_setzero_pd()};
+    for (; i + 8 <= size; i += 8) {
+        const auto x{_mm512_loadu_pd(input + i)};
+        const auto e{_mm512_fnmadd_pd(w, x, _mm512_sub_pd(_mm512_loadu_pd(reference + i), b))};
+        errors = _mm512_add_pd(errors, e);
+        weighted_errors = _mm512_fmadd_pd(e, x, weighted_errors);
+    }
+    error_sum = detail::Sum(errors);
+    error_input_sum = detail::Sum(weighted_errors);
+#elif defined(__AVX2__) && defined(__FMA__)
+    const auto w{_mm256_set1_pd(weight)};
+    const auto b{_mm256_set1_pd(bias)};
+    auto errors{_mm256_setzero_pd()}, weighted_errors{_mm256_setzero_pd()};
+    for (; i + 4 <= size; i += 4) {
+        const auto x{_mm256_loadu_pd(input + i)};
+        const auto e{_mm256_fnmadd_pd(w, x, _mm256_sub_pd(_mm256_loadu_pd(reference + i), b))};
+        errors = _mm256_add_pd(errors, e);
+        weighted_errors = _mm256_fmadd_pd(e, x, weighted_errors);
+    }
+    error_sum = detail::Sum(errors);
+    error_input_sum = detail::Sum(weighted_errors);
+#elif defined(__SSE2__)
+    const auto w{_mm_set1_pd(weight)};
+    const auto b{_mm_set1_pd(bias)};
+    auto errors{_mm_setzero_pd()}, weighted_errors{_mm_setzero_pd()};
+    for (; i + 2 <= size; i += 2) {
+        const auto x{_mm_loadu_pd(input + i)};
+        const auto e{_mm_sub_pd(_mm_sub_pd(_mm_loadu_pd(reference + i), b), _mm_mul_pd(w, x))};
+        errors = _mm_add_pd(errors, e);
+        weighted_errors = _mm_add_pd(weighted_errors, _mm_mul_pd(e, x));
+    }
+    error_sum = detail::Sum(errors);
+    error_input_sum = detail::Sum(weighted_errors);
+#endif
+    for (; i < size; ++i) {
+        const auto error{reference[i] - (weight * input[i] + bias)};
+        error_sum += error;
+        error_input_sum += error * input[i];
+    }
+}
+
+/********************************************************************************
+ * @brief Returns the dot product of specified arrays, i.e. the sum of a[i] * b[i].
+ *
+ * @param a
+ *        Pointer to the first array.
+ * @param b
+ *        Pointer to the second array.
+ * @param size
+ *        The number of values of each array.
+ * @return
+ *        The dot product.
+ ********************************************************************************/
+template <typename T>
+inline T Dot(const T* a, const T* b, const size_t size) {
+    T sum{};
+    for (size_t i{}; i < size; ++i) {
+        sum = fixed::MulAdd(a[i], b[i], sum);
+    }
+    return sum;
+}
+
+/********************************************************************************
+ * @brief Returns the dot product of specified arrays with double precision,
+ *        using the widest SIMD instructions available.
+ *
+ * @param a
+ *        Pointer to the first array.
+ * @param b
+ *        Pointer to the second array.
+ * @param size
+ *        The number of values of each array.
+ * @return
+ *        The dot product.
+ ********************************************************************************/
+inline double Dot(const double* a, const double* b, const size_t size) {
+    size_t i{};
+    double sum{};
+#if defined(__AVX512F__)
+    auto sums{_mm512_setzero_pd()};
+    for (; i + 8 <= size; i += 8) {
+        sums = _mm512_fmadd_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i), sums);
+    }
+    sum = detail::Sum(sums);
+#elif defined(__AVX2__) && defined(__FMA__)
+    auto sums{_mm256_setzero_pd()};
+    for (; i + 4 <= size; i += 4) {
+        sums = _mm256_fmadd_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), sums);
+    }
+    sum = detail::Sum(sums);
+#elif defined(__SSE2__)
+    auto sums{_mm_setzero_pd()};
+    for (; i + 2 <= size; i += 2) {
+        sums = _mm_add_pd(sums, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+    }
+    sum = detail::Sum(sums);
+#endif
+    for (; i < size; ++i) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+/********************************************************************************
+ * @brief Calculates output[i] = output[i] + factor * input[i] for each value.
+ *
+ * @param input
+ *        Pointer to the input values.
+ * @param output
+ *        Pointer to the output values to add to.
+ * @param size
+ *        The number of values.
+ * @param factor
+ *        The factor to multiply each input value with.
+ ********************************************************************************/
+template <typename T>
+inline void AddScaled(const T* input, T* output, const size_t size, const T factor) {
+    for (size_t i{}; i < size; ++i) {
+        output[i] = fixed::MulAdd(factor, input[i], output[i]);
+    }
+}
+
+/********************************************************************************
+ * @brief Calculates output[i] = output[i] + factor * input[i] for each value
+ *        with double precision, using the widest SIMD instructions available.
+ *
+ * @param input
+ *        Pointer to the input values.
+ * @param output
+ *        Pointer to the output values to add to.
+ * @param size
+ *        The number of values.
+ * @param factor
+ *        The factor to multiply each input value with.
+ ********************************************************************************/
+inline void AddScaled(const double* input, double* output, const size_t size, const double factor) {
+    size_t i{};
+#if defined(__AVX512F__)
+    const auto f{_mm512_set1_pd(factor)};
+    for (; i + 8 <= size; i += 8) {
+        _mm512_storeu_pd(output + i, _mm512_fmadd_pd(f, _mm512_loadu_pd(input + i), 
+                                                     _mm512_loadu_pd(output + i)));
+    }
+#elif defined(__AVX2__) && defined(__FMA__)
+    const auto f{_mm256_set1_pd(factor)};
+    for (; i + 4 <= size; i += 4) {
+        _mm256_storeu_pd(output + i, _mm256_fmadd_pd(f, _mm256_loadu_pd(input + i), 
+                                                     _mm256_loadu_pd(output + i)));
+    }
+#elif defined(__SSE2__)
+    const auto f{_mm_set1_pd(factor)};
+    for (; i + 2 <= size; i += 2) {
+        _mm_storeu_pd(output + i, _mm_add_pd(_mm_mul_pd(f, _mm_loadu_pd(input + i)), 
+                                             _mm_loadu_pd(output + i)));
+    }
+#endif
+    for (; i < size; ++i) {
+        output[i] += factor * input[i];
+    }
+}
+
+} /* namespace simd */
+} /* namespace yrgo */
@@ -0,0 +1,464 @@
+/********************************************************************************
+ * @brief Implementation of fixed-capacity container::StaticVectors of any data
+ *        type, which never allocate memory on the heap.
+ ********************************************************************************/
+#pragma once
+
+#include "container.hpp"
+#include <stdint.h>
+
+namespace yrgo {
+namespace container {
+
+/********************************************************************************
+ * @brief Class for implementation of container::StaticVectors, whose elements
+ *        are stored within the object itself up to a capacity specified at
+ *        compile time. No memory is ever allocated on the heap, so the memory
+ *        usage is deterministic and the heap isn't fragmented. The storage is
+ *        placed wherever the object is, e.g. in static memory for global objects.
+ *        The API is the same as for container::Vector, but operations exceeding
+ *        the capacity fail and leave the container::StaticVector unchanged.
+ *
+ *        Classes storing their data in a container taking the element type only,
+ *        such as LinReg, can use a container::StaticVector via an alias template:
+ *
+ *        template <typename T>
+ *        using StaticBuffer = container::StaticVector<T, 32>;
+ *        LinReg<fixed::Q16_16, optimizer::Sgd, StaticBuffer> model{};
+ *
+ * @tparam T
+ *         The type of the stored elements.
+ * @tparam capacity
+ *         The maximum number of elements.
+ ********************************************************************************/
+template <typename T, size_t capacity>
+class StaticVector {
+    static_assert(capacity > 0, "The capacity must be at least one element!");
+  public:
+
+    /********************************************************************************
+     * @brief Default constructor, creates empty container::StaticVector.
+     ********************************************************************************/
+    StaticVector(void) noexcept = default;
+
+    /********************************************************************************
+     * @brief Creates container::StaticVector of specified size. The container is
+     *        left empty if the size exceeds the capacity.
+     *
+     * @param size
+     *        The size of the container::StaticVector, i.e. the number of elements it holds.
+     ********************************************************************************/
+    explicit StaticVector(const size_t size) noexcept {
+        Resize(size);
+    }
+
+    /********************************************************************************
+     * @brief Creates container::StaticVector containing referenced values.
+     *
+     * @param values
+     *        Reference to the values to store in newly created container::StaticVector.
+     ********************************************************************************/
+    template <size_t size>
+    StaticVector(const T (&values)[size]) noexcept {
+        static_assert(size <= capacity, "The values exceed the capacity!");
+        AddValues(values);
+    }
+
+    /********************************************************************************
+     * @brief Creates container::StaticVector as a copy of referenced source.
+     *
+     * @param source
+     *        Reference to container::StaticVector whose content is copied.
+     ********************************************************************************/
+    StaticVector(const StaticVector& source) noexcept {
+        AddValues(source);
+    }
+
+    /********************************************************************************
+     * @brief Move constructor, moves the elements of referenced source one by one
+     *        to assigned container::StaticVector. The source is emptied after the
+     *        move operation is performed.
+     *
+     * @param source
+     *        Reference to container::StaticVector whose content is moved.
+     ********************************************************************************/
+    StaticVector(StaticVector&& source) noexcept {
+        MoveFrom(source);
+    }
+
+    /********************************************************************************
+     * @brief Destructor, destroys the stored elements.
+     ********************************************************************************/
+    ~StaticVector(void) noexcept { Clear(); }
+
+    /********************************************************************************
+     * @brief Index operator, returns reference to the element at specified index.
+     *
+     * @param index
+     *        Index to searched element.
+     * @return
+     *        A reference to the element at specified index.
+     ********************************************************************************/
+    T& operator[](const size_t index) noexcept {
+        return Data()[index];
+    }
+
+    /********************************************************************************
+     * @brief Index operator, returns reference to the element at specified index.
+     *
+     * @param index
+     *        Index to searched element.
+     * @return
+     *        A reference to the element at specified index.
+     ********************************************************************************/
+    const T& operator[](const size_t index) const noexcept {
+        return Data()[index];
+    }
+
+    /********************************************************************************
+     * @brief Assignment operator, copies referenced values to assigned
+     *        container::StaticVector. Previous values are cleared before copying.
+     *
+     * @param values
+     *        Referenced values to copy.
+     ********************************************************************************/
+    template <size_t size>
+    void operator=(const T (&values)[size]) noexcept {
+        static_assert(size <= capacity, "The values exceed the capacity!");
+        Clear();
+        AddValues(values);
+    }
+
+    /********************************************************************************
+     * @brief Assignment operator, copies the content of referenced container::StaticVector
+     *        to assigned container::StaticVector. Previous values are cleared before copying.
+     *
+     * @param source
+     *        Reference to container::StaticVector containing the the values to copy.
+     ********************************************************************************/
+    void operator=(const StaticVector& source) noexcept {
+        if (&source == this) return;
+        Clear();
+        AddValues(source);
+    }
+
+    /********************************************************************************
+     * @brief Move assignment operator, moves the elements of referenced source to
+     *        assigned container::StaticVector. Previous values are cleared before
+     *        moving and the source is emptied after the move operation is performed.
+     *
+     * @param source
+     *        Reference to container::StaticVector whose content is moved.
+     ********************************************************************************/
+    void operator=(StaticVector&& source) noexcept {
+        if (&source == this) return;
+        Clear();
+        MoveFrom(source);
+    }
+
+    /********************************************************************************
+     * @brief Addition operator, pushes referenced values to the back of the
+     *        container::StaticVector if they fit.
+     *
+     * @param values
+     *        Reference to the values to add.
+     ********************************************************************************/
+    template <size_t size>
+    void operator+=(const T (&values)[size]) noexcept {
+        AddValues(values);
+    }
+
+    /********************************************************************************
+     * @brief Adds values from referenced container::StaticVector to the back of assigned
+     *        container::StaticVector if they fit.
+     *
+     * @param source
+     *        Reference to container::StaticVector containing the the values to add.
+     ********************************************************************************/
+    void operator+=(const StaticVector& source) noexcept {
+        AddValues(source);
+    }
+
+    /********************************************************************************
+     * @brief Returns a pointer to the stored elements.
+     *
+     * @return
+     *        A pointer to the storage of the elements.
+     ********************************************************************************/
+    T* Data(void) noexcept {
+        return reinterpret_cast<T*>(buffer_);
+    }
+
+    /********************************************************************************
+     * @brief Returns a pointer to the stored elements.
+     *
+     * @return
+     *        A pointer to the storage of the elements.
+     ********************************************************************************/
+    const T* Data(void) const noexcept {
+        return reinterpret_cast<const T*>(buffer_);
+    }
+
+    /********************************************************************************
+     * @brief Returns the size of referenced container::StaticVector, i.e. the number of
+     *        elements it holds.
+     *
+     * @return
+     *        The size of the container::StaticVector as the number of elements it holds.
+     ********************************************************************************/
+    size_t Size(void) const noexcept {
+        return size_;
+    }
+
+    /********************************************************************************
+     * @brief Returns the capacity of container::StaticVectors of this type, i.e.
+     *        the maximum number of elements.
+     *
+     * @return
+     *        The capacity as the number of elements.
+     ********************************************************************************/
+    static constexpr size_t Capacity(void) noexcept {
+        return capacity;
+    }
+
+    /********************************************************************************
+     * @brief Checks if referenced container::StaticVector is empty.
+     *
+     * @return
+     *        True if referenced container::StaticVector is empty, else false.
+     ********************************************************************************/
+    bool Empty(void) const noexcept {
+        return size_ == 0 ? true : false;
+    }
+
+    /********************************************************************************
+     * @brief Checks if referenced container::StaticVector is full.
+     *
+     * @return
+     *        True if referenced container::StaticVector is full, else false.
+     ********************************************************************************/
+    bool Full(void) const noexcept {
+        return size_ == capacity ? true : false;
+    }
+
+    /********************************************************************************
+     * @brief Returns the start address of referenced container::StaticVector.
+     *
+     * @return
+     *        A pointer to the first element of referenced container::StaticVector.
+     ********************************************************************************/
+    T* begin(void) noexcept { return Data(); }
+
+    /********************************************************************************
+     * @brief Returns the start address of referenced container::StaticVector.
+     *
+     * @return
+     *        A pointer to the first element of referenced container::StaticVector.
+     ********************************************************************************/
+    const T* begin(void) const noexcept { return Data(); }
+
+    /********************************************************************************
+     * @brief Returns the end address of referenced container::StaticVector.
+     *
+     * @return
+     *        A pointer to the address after the last element.
+     ********************************************************************************/
+    T* end(void) noexcept { return Data() + size_; }
+
+    /********************************************************************************
+     * @brief Returns the end address of referenced container::StaticVector.
+     *
+     * @return
+     *        A pointer to the address after the last element.
+     ********************************************************************************/
+    const T* end(void) const noexcept { return Data() + size_; }
+
+    /********************************************************************************
+     * @brief Returns the address of the last element stored in referenced
+     *        container::StaticVector.
+     *
+     * @return
+     *        A pointer to the last element, or a null pointer if empty.
+     ********************************************************************************/
+    T* last(void) noexcept { return size_ > 0 ? end() - 1 : nullptr; }
+
+    /********************************************************************************
+     * @brief Returns the address of the last element stored in referenced
+     *        container::StaticVector.
+     *
+     * @return
+     *        A pointer to the last element, or a null pointer if empty.
+     ********************************************************************************/
+    const T* last(void) const noexcept { return size_ > 0 ? end() - 1 : nullptr; }
+
+    /********************************************************************************
+     * @brief Clears content of referenced container::StaticVector by destroying the
+     *        stored elements.
+     ********************************************************************************/
+    void Clear(void) noexcept {
+        detail::Destroy<T>(Data(), size_);
+        size_ = 0;
+    }
+
+    /********************************************************************************
+     * @brief Resizes referenced container::StaticVector to specified new size. Added
+     *        elements are default initialized and removed elements are destroyed.
+     *
+     * @param new_size
+     *        The new size of the container::StaticVector.
+     * @return
+     *        True if the container::StaticVector was resized, false if the new size
+     *        exceeds the capacity (the container::StaticVector is unchanged).
+     ********************************************************************************/
+    bool Resize(const size_t new_size) noexcept {
+        if (new_size > capacity) return false;
+        if (new_size < size_) {
+            detail::Destroy<T>(Data() + new_size, size_ - new_size);
+        } else {
+            for (size_t i{size_}; i < new_size; ++i) {
+                new (Data() + i) T;
+            }
+        }
+        size_ = new_size;
+        return true;
+    }
+
+    /********************************************************************************
+     * @brief Checks that specified number of elements fit, since the storage of a
+     *        container::StaticVector is always reserved.
+     *
+     * @param num_elements
+     *        The number of elements to reserve memory for.
+     * @return
+     *        True if the elements fit within the capacity, else false.
+     ********************************************************************************/
+    static constexpr bool Reserve(const size_t num_elements) noexcept {
+        return num_elements <= capacity;
+    }
+
+    /********************************************************************************
+     * @brief Does nothing, since the storage of a container::StaticVector can't be
+     *        released. Provided for compatibility with container::Vector.
+     *
+     * @return
+     *        True.
+     ********************************************************************************/
+    static constexpr bool ShrinkToFit(void) noexcept { return true; }
+
+    /********************************************************************************
+     * @brief Pushes new value to the back of referenced container::StaticVector.
+     *
+     * @param value
+     *        Reference to the new value to push.
+     * @return
+     *        True if the value was pushed to the back, false if full.
+     ********************************************************************************/
+    bool PushBack(const T& value) noexcept {
+        return EmplaceBack(value);
+    }
+
+    /********************************************************************************
+     * @brief Pushes new value to the back of referenced container::StaticVector by
+     *        moving it.
+     *
+     * @param value
+     *        Reference to the new value to move.
+     * @return
+     *        True if the value was pushed to the back, false if full.
+     ********************************************************************************/
+    bool PushBack(T&& value) noexcept {
+        return EmplaceBack(detail::Move(value));
+    }
+
+    /********************************************************************************
+     * @brief Constructs new value in place at the back of referenced container::StaticVector.
+     *
+     * @param args
+     *        Arguments forwarded to the constructor of the new value.
+     * @return
+     *        True if the value was constructed at the back, false if full.
+     ********************************************************************************/
+    template <typename... Args>
+    bool EmplaceBack(Args&&... args) noexcept {
+        if (size_ == capacity) return false;
+        new (Data() + size_) T(detail::Forward<Args>(args)...);
+        ++size_;
+        return true;
+    }
+
+    /********************************************************************************
+     * @brief Pops value at the back of referenced container::StaticVector.
+     *
+     * @return
+     *        True if the last value was popped, else false.
+     ********************************************************************************/
+    bool PopBack(void) noexcept {
+        if (size_ > 0) Data()[--size_].~T();
+        return true;
+    }
+
+  private:
+    alignas(T) uint8_t buffer_[sizeof(T) * capacity]; /* Storage, left uninitialized. */
+    size_t size_{};                                   /* The number of elements it holds. */
+
+    /********************************************************************************
+     * @brief Moves the elements of referenced source to the empty container::StaticVector.
+     *        The source is emptied afterwards.
+     *
+     * @param source
+     *        Reference to container::StaticVector whose content is moved.
+     ********************************************************************************/
+    void MoveFrom(StaticVector& source) noexcept {
+        detail::MoveConstruct<T>(source.Data(), Data(), source.size_);
+        size_ = source.size_;
+        source.size_ = 0;
+    }
+
+    /********************************************************************************
+     * @brief Adds referenced values to the back of the container::StaticVector.
+     *
+     * @param values
+     *        Reference to values to copy and add to the back.
+     * @return
+     *        True if the values were added, false if they don't fit (nothing is added).
+     ********************************************************************************/
+    template <size_t size>
+    bool AddValues(const T (&values)[size]) noexcept {
+        return Append(values, size);
+    }
+
+    /********************************************************************************
+     * @brief Adds values from referenced source to the back of the container::StaticVector.
+     *
+     * @param source
+     *        Reference to container::StaticVector whose content is copied and added.
+     * @return
+     *        True if the values were added, false if they don't fit (nothing is added).
+     ********************************************************************************/
+    bool AddValues(const StaticVector& source) noexcept {
+        return Append(source.Data(), source.size_);
+    }
+
+    /********************************************************************************
+     * @brief Copy constructs specified number of values at the back of the
+     *        container::StaticVector.
+     *
+     * @param values
+     *        Pointer to the values to copy.
+     * @param count
+     *        The number of values to copy.
+     * @return
+     *        True if the values were added, false if they don't fit (nothing is added).
+     ********************************************************************************/
+    bool Append(const T* values, const size_t count) noexcept {
+        if (count > capacity - size_) return false;
+        for (size_t i{}; i < count; ++i) {
+            new (Data() + size_ + i) T(values[i]);
+        }
+        size_ += count;
+        return true;
+    }
+};
+
+} /* namespace container */
+} /* namespace yrgo */
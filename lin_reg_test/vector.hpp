@@ -9,7 +9,16 @@ namespace yrgo {
 namespace container {
 
 /********************************************************************************
- * @brief Class for implementation of dynamic container::Vectors.
+ * @brief Class for implementation of dynamic container::Vectors. The allocated
+ *        memory block (the capacity) can hold more elements than currently
+ *        stored (the size). When pushing to a full container::Vector, the capacity
+ *        grows geometrically by 50 %, so pushing n values requires O(log n)
+ *        reallocations and O(n) copying in total.
+ *
+ *        Elements are constructed in place and destroyed when removed, so any
+ *        type can be stored, such as container::Vectors or models. Trivially
+ *        copyable types are relocated via reallocation when growing, while
+ *        other types are moved element by element instead of deep copied.
  ********************************************************************************/
 template <typename T>
 class Vector {
@@ -24,9 +33,9 @@ class Vector {
      * @brief Creates container::Vector of specified size.
      *
      * @param size
-     *        The size of the container::Vector, i.e. the number of elements it can hold.
+     *        The size of the container::Vector, i.e. the number of elements it holds.
      ********************************************************************************/
-    Vector(const size_t size) noexcept {
+    explicit Vector(const size_t size) noexcept {
         Resize(size);
     }
 
@@ -38,9 +47,7 @@ class Vector {
      ********************************************************************************/
     template <size_t size>
     Vector(const T (&values)[size]) noexcept {
-        if (Resize(size)) {
-            Assign(values);
-        }
+        AddValues(values);
     }
 
     /********************************************************************************
@@ -50,7 +57,7 @@ class Vector {
      *        Reference to container::Vector whose content is copied to the new container::Vector.
      ********************************************************************************/
     Vector(const Vector& source) noexcept { 
-        Copy(source); 
+        AddValues(source); 
     }
 
     /********************************************************************************
@@ -63,8 +70,10 @@ class Vector {
     Vector(Vector&& source) noexcept {
         data_ = source.data_;
         size_ = source.size_;
+        capacity_ = source.capacity_;
         source.data_ = nullptr;
         source.size_ = 0;
+        source.capacity_ = 0;
     }
 
     /********************************************************************************
@@ -111,7 +120,7 @@ class Vector {
     template <size_t size>
     void operator=(const T (&values)[size]) noexcept {
         Clear();
-        Copy(values);
+        AddValues(values);
     }
 
     /********************************************************************************
@@ -122,8 +131,28 @@ class Vector {
      *        Reference to container::Vector containing the the values to add.    
      ********************************************************************************/
     void operator=(const Vector& source) noexcept {
+        if (&source == this) return;
         Clear();
-        Copy(source);
+        AddValues(source);
+    }
+
+    /********************************************************************************
+     * @brief Move assignment operator, moves content from referenced source to 
+     *        assigned container::Vector. Previous values are cleared before moving
+     *        and the source is emptied after the move operation is performed.
+     *
+     * @param source
+     *        Reference to container::Vector whose content is moved.
+     ********************************************************************************/
+    void operator=(Vector&& source) noexcept {
+        if (&source == this) return;
+        Clear();
+        data_ = source.data_;
+        size_ = source.size_;
+        capacity_ = source.capacity_;
+        source.data_ = nullptr;
+        source.size_ = 0;
+        source.capacity_ = 0;
     }
 
     /********************************************************************************
@@ -169,15 +198,26 @@ class Vector {
 
     /********************************************************************************
      * @brief Returns the size of referenced container::Vector, i.e. the number of elements 
-     *        it can hold.
+     *        it holds.
      *
      * @return
-     *        The size of the container::Vector as the number of elements it can hold.
+     *        The size of the container::Vector as the number of elements it holds.
      ********************************************************************************/
     size_t Size(void) const noexcept {
         return size_;
     }
 
+    /********************************************************************************
+     * @brief Returns the capacity of referenced container::Vector, i.e. the number of
+     *        elements it can hold without reallocation.
+     *
+     * @return
+     *        The capacity of the container::Vector as the number of elements.
+     ********************************************************************************/
+    size_t Capacity(void) const noexcept {
+        return capacity_;
+    }
+
     /********************************************************************************
      * @brief Checks if referenced container::Vector is empty.
      *
@@ -237,29 +277,81 @@ class Vector {
     const T* last(void) const noexcept { return size_ > 0 ? end() - 1 : nullptr; }
 
     /********************************************************************************
-     * @brief Clears content of referenced container::Vector by deallocating memory on the
-     *        heap. All member variables are reset to starting values.
+     * @brief Clears content of referenced container::Vector by destroying the elements
+     *        and deallocating memory on the heap. All member variables are reset 
+     *        to starting values.
      ********************************************************************************/
     void Clear(void) noexcept {
+        detail::Destroy<T>(data_, size_);
         detail::Delete<T>(data_);
         size_ = 0;
+        capacity_ = 0;
     }
 
     /********************************************************************************
-     * @brief Resizes referenced container::Vector to specified new size via reallocation
-     *        of heap allocated memory block. The memory block is unchanged if
-     *        the memory allocation fails.
+     * @brief Resizes referenced container::Vector to specified new size. The heap
+     *        allocated memory block is only reallocated if the new size exceeds
+     *        the capacity, in which case exactly new_size elements are allocated.
+     *        Added elements are default initialized, i.e. trivial types such as
+     *        numbers are left uninitialized. Removed elements are destroyed, but 
+     *        shrinking keeps the capacity, see ShrinkToFit. The memory block is
+     *        unchanged if the memory allocation fails.
      *
      * @param new_size
-     *        The new size of the container::Vector after reallocation.
+     *        The new size of the container::Vector.
      * @return
-     *        True if the reallocation succeeded, else false.
+     *        True if the container::Vector was resized, else false.
      ********************************************************************************/
     bool Resize(const size_t new_size) noexcept {
-        auto copy{detail::Resize<T>(data_, new_size)};
+        if (new_size < size_) {
+            detail::Destroy<T>(data_ + new_size, size_ - new_size);
+        } else {
+            if (!Reserve(new_size)) return false;
+            for (size_t i{size_}; i < new_size; ++i) {
+                new (data_ + i) T;
+            }
+        }
+        size_ = new_size;
+        return true;
+    }
+
+    /********************************************************************************
+     * @brief Reserves memory for at least specified number of elements via
+     *        relocation, so that the container::Vector can grow to this size
+     *        without further reallocations. The size is unchanged.
+     *
+     * @param capacity
+     *        The number of elements to reserve memory for.
+     * @return
+     *        True if the memory was reserved, false if the memory allocation failed.
+     ********************************************************************************/
+    bool Reserve(const size_t capacity) noexcept {
+        if (capacity <= capacity_) return true;
+        auto copy{detail::Relocate<T>(data_, size_, capacity)};
         if (copy == nullptr) return false;
         data_ = copy;
-        size_ = new_size;
+        capacity_ = capacity;
+        return true;
+    }
+
+    /********************************************************************************
+     * @brief Releases unused capacity via relocation, so that the capacity
+     *        equals the size. The memory block is deallocated if the
+     *        container::Vector is empty.
+     *
+     * @return
+     *        True if the unused capacity was released, else false.
+     ********************************************************************************/
+    bool ShrinkToFit(void) noexcept {
+        if (size_ == capacity_) return true;
+        if (size_ == 0) {
+            Clear();
+            return true;
+        }
+        auto copy{detail::Relocate<T>(data_, size_, size_)};
+        if (copy == nullptr) return false;
+        data_ = copy;
+        capacity_ = size_;
         return true;
     }
 
@@ -272,84 +364,86 @@ class Vector {
      *        True if the value was pushed to the back of the container::Vector, else false.
      ********************************************************************************/
     bool PushBack(const T& value) noexcept {
-        if (Resize(size_ + 1)) {
-            data_[size_ - 1] = value;
-            return true;
-        } else {
-            return false;
-        }
+        return EmplaceBack(value);
+    }
+
+    /********************************************************************************
+     * @brief Pushes new value to the back of referenced container::Vector by moving it.
+     *
+     * @param value
+     *        Reference to the new value to move to the container::Vector.
+     * @return
+     *        True if the value was pushed to the back of the container::Vector, else false.
+     ********************************************************************************/
+    bool PushBack(T&& value) noexcept {
+        return EmplaceBack(detail::Move(value));
+    }
+
+    /********************************************************************************
+     * @brief Constructs new value in place at the back of referenced container::Vector.
+     *
+     * @param args
+     *        Arguments forwarded to the constructor of the new value.
+     * @return
+     *        True if the value was constructed at the back of the container::Vector, 
+     *        else false.
+     ********************************************************************************/
+    template <typename... Args>
+    bool EmplaceBack(Args&&... args) noexcept {
+        if (size_ == capacity_) return GrowAndEmplaceBack(detail::Forward<Args>(args)...);
+        new (data_ + size_) T(detail::Forward<Args>(args)...);
+        ++size_;
+        return true;
     }
 
     /******************************************************************************** 
-     * @brief Pops value at the back of referenced container::Vector via reallocation.
+     * @brief Pops value at the back of referenced container::Vector. The capacity is
+     *        kept, so no reallocation is performed, see ShrinkToFit.
      *
      * @return
      *        True if the last value of the container::Vector was popped, else false.
      ********************************************************************************/
     bool PopBack(void) noexcept {
-        if (size_ <= 1) {
-            Clear();
-            return true;
-        } else {
-            return Resize(size_ - 1);
-        }
+        if (size_ > 0) data_[--size_].~T();
+        return true;
     }
 
   private:
+    static constexpr size_t kMinCapacity{4}; /* Capacity allocated by the first push. */
+
     T* data_{nullptr}; /* Pointer to dynamically allocated memory block. */
-    size_t size_{};    /* The size of the container::Vector in number of elements it can hold. */
+    size_t size_{};    /* The size of the container::Vector in number of elements it holds. */
+    size_t capacity_{}; /* The number of elements the memory block can hold. */
 
     /********************************************************************************
-     * @brief Copies the content of referenced source. All previous elements are
-     *        either removed or overwritten.
+     * @brief Reserves memory for at least specified number of elements. If the
+     *        capacity is exceeded, it grows by 50 % (at least to kMinCapacity)
+     *        or to the required size if larger.
      *
-     * @param source
-     *        Reference to container::Vector whose content is copied.
+     * @param required
+     *        The number of elements the container::Vector must be able to hold.
      * @return
-     *        True if the content of the source container::Vector was copied, else false.
-     ********************************************************************************/
-    bool Copy(const Vector& source) noexcept {
-        if (Resize(source.size_)) {
-            Assign(source);
-            return true;
-        } else {
-            return false;
-        }
-    }
-
-    /********************************************************************************
-     * @brief Assigns referenced values without changing the container::Vector size. An offset 
-     *        can be specified to assign the values further back in referenced container::Vector. 
-     *        The offset should be set to the index of the first assigned value.
-     *
-     * @param values
-     *        Referenced values to assign.
-     * @param offset
-     *        Offset to assign values from a specified starting index.
+     *        True if the memory was reserved, false if the memory allocation failed.
      ********************************************************************************/
-    template <size_t size>
-    void Assign(const T (&values)[size], const size_t offset = 0) noexcept {
-        for (size_t i{}; i < size && offset + i < size_; ++i) {
-            data_[offset + i] = values[i];
-        }
+    bool Grow(const size_t required) noexcept {
+        if (required <= capacity_) return true;
+        auto capacity{capacity_ + capacity_ / 2};
+        if (capacity < kMinCapacity) capacity = kMinCapacity;
+        return Reserve(capacity < required ? required : capacity);
     }
 
     /********************************************************************************
-     * @brief Assigns values from referenced source container::Vector without changing the
-     *        container::Vector size. An offset can be specified to assign the values further
-     *        back in referenced container::Vector. The offset should be set to the index of
-     *        the first assigned value.
+     * @brief Grows the full container::Vector and constructs new value at the back.
+     *        Kept apart from EmplaceBack so that its common path is inlined.
      *
-     * @param source
-     *        Reference to container::Vector containing values to assign.
-     * @param offset
-     *        Offset to assign values from a specified starting index.
+     * @param args
+     *        Arguments forwarded to the constructor of the new value.
+     * @return
+     *        True if the value was constructed at the back of the container::Vector, 
+     *        else false.
      ********************************************************************************/
-    void Assign(const Vector& source, const size_t offset = 0) noexcept {
-        for (size_t i{}; offset + i < size_ && i < source.size_; ++i) {
-            data_[offset + i] = source.data_[i];
-        }
-    }
+    template <typename... Args>
+    bool GrowAndEmplaceBack(Args&&... args) noexcept;
 
     /********************************************************************************
      * @brief Adds referenced values to the back of the container::Vector.
@@ -361,13 +455,9 @@ class Vector {
      ********************************************************************************/
     template <size_t size>
     bool AddValues(const T (&values)[size]) noexcept {
-        const auto offset{size_};
-        if (Resize(size_ + size)) {
-            Assign(values, offset);
-            return true;
-        } else {
-            return false;
-        }
+        if (!Grow(size_ + size)) return false;
+        Append(values, size);
+        return true;
     }
 
     /********************************************************************************
@@ -379,15 +469,44 @@ class Vector {
      *        True if the values were added, else false.
      ********************************************************************************/
     bool AddValues(const Vector& source) noexcept {
-        const auto offset{size_};
-        if (Resize(size_ + source.size_)) {
-            Assign(source, offset);
-            return true;
-        } else {
-            return false;
+        if (!Grow(size_ + source.size_)) return false;
+        Append(source.data_, source.size_);
+        return true;
+    }
+
+    /********************************************************************************
+     * @brief Copy constructs specified number of values at the back of the 
+     *        container::Vector, whose capacity must already be sufficient.
+     *
+     * @param values
+     *        Pointer to the values to copy.
+     * @param count
+     *        The number of values to copy.
+     ********************************************************************************/
+    void Append(const T* values, const size_t count) noexcept {
+        for (size_t i{}; i < count; ++i) {
+            new (data_ + size_ + i) T(values[i]);
         }
+        size_ += count;
     }
 };
 
+/********************************************************************************
+ * @note  Implementation details:
+ *        1. The value is constructed before growing, since the arguments may
+ *           refer to elements of the container::Vector, which are relocated 
+ *           when growing.
+ *        2. The value is then moved to the back of the container::Vector.
+ ********************************************************************************/
+template <typename T>
+template <typename... Args>
+bool Vector<T>::GrowAndEmplaceBack(Args&&... args) noexcept {
+    T value(detail::Forward<Args>(args)...);
+    if (!Grow(size_ + 1)) return false;
+    new (data_ + size_) T(detail::Move(value));
+    ++size_;
+    return true;
+}
+
 } /* namespace container */
 } /* namespace yrgo */
\ No newline at end of file